@@ -4,4 +4,6 @@
 
 #include "Modules/ModuleManager.h"
 
+DEFINE_STAT(STAT_BTTaskExecutions);
+
 IMPLEMENT_PRIMARY_GAME_MODULE(FDefaultGameModuleImpl, ActionRPG, "ActionRPG");
@@ -3,3 +3,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+// Stat group for gameplay systems (use "stat ActionRPG" in the console)
+DECLARE_STATS_GROUP(TEXT("ActionRPG"), STATGROUP_ActionRPG, STATCAT_Advanced);
+
+// Behavior tree task entries, shared by the enemy BT tasks
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("BT Task Executions / Frame"),
+	STAT_BTTaskExecutions, STATGROUP_ActionRPG, ACTIONRPG_API);
@@ -3,18 +3,57 @@
 #include "BTTask_AttackPlayer.h"
 
 #include "AIController.h"
+#include "ActionRPG.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "GameFramework/Character.h"
+#include "MyBlackboardKeys.h"
 #include "MyEnemy.h"
 
 UBTTask_AttackPlayer::UBTTask_AttackPlayer()
 {
 	NodeName = "Attack Player";
+
+	bNotifyTaskFinished = true;
+
+	// Per-AI state lives in FBTAttackPlayerMemory
+	bCreateNodeInstance = false;
+}
+
+void UBTTask_AttackPlayer::InitializeFromAsset(UBehaviorTree &Asset)
+{
+	Super::InitializeFromAsset(Asset);
+
+	// Resolve key IDs once per tree asset; executions read by ID
+	if(const UBlackboardData *BlackboardAsset = GetBlackboardAsset())
+	{
+		PlayerKey.ResolveSelectedKey(*BlackboardAsset);
+		AttackRangeKey.ResolveSelectedKey(*BlackboardAsset);
+	}
+}
+
+uint16 UBTTask_AttackPlayer::GetInstanceMemorySize() const
+{
+	return sizeof(FBTAttackPlayerMemory);
+}
+
+void UBTTask_AttackPlayer::InitializeMemory(UBehaviorTreeComponent &OwnerComp,
+	uint8 *NodeMemory, EBTMemoryInit::Type InitType) const
+{
+	InitializeNodeMemory<FBTAttackPlayerMemory>(NodeMemory, InitType);
+}
+
+void UBTTask_AttackPlayer::CleanupMemory(UBehaviorTreeComponent &OwnerComp,
+	uint8 *NodeMemory, EBTMemoryClear::Type CleanupType) const
+{
+	CleanupNodeMemory<FBTAttackPlayerMemory>(NodeMemory, CleanupType);
 }
 
 EBTNodeResult::Type UBTTask_AttackPlayer::ExecuteTask(
 	UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory)
 {
+	INC_DWORD_STAT(STAT_BTTaskExecutions);
+
 	AAIController *AIController = OwnerComp.GetAIOwner();
 	if(!AIController)
 	{
@@ -35,7 +74,7 @@ EBTNodeResult::Type UBTTask_AttackPlayer::ExecuteTask(
 
 	// Get player from blackboard
 	UObject *PlayerObject =
-		BlackboardComp->GetValueAsObject(PlayerKey.SelectedKeyName);
+		MyBlackboard::GetObject(BlackboardComp, PlayerKey.GetSelectedKeyID());
 	if(!PlayerObject || PlayerObject->IsDefaultSubobject()
 		|| !PlayerObject->IsA(ACharacter::StaticClass()))
 	{
@@ -44,8 +83,8 @@ EBTNodeResult::Type UBTTask_AttackPlayer::ExecuteTask(
 	ACharacter *PlayerCharacter = Cast<ACharacter>(PlayerObject);
 
 	// Get attack range
-	float AttackRange =
-		BlackboardComp->GetValueAsFloat(AttackRangeKey.SelectedKeyName);
+	float AttackRange = MyBlackboard::GetFloat(
+		BlackboardComp, AttackRangeKey.GetSelectedKeyID());
 	if(AttackRange <= 0.0f)
 	{
 		AttackRange = Enemy->AttackRange; // Fallback to enemy's default
@@ -60,14 +99,85 @@ EBTNodeResult::Type UBTTask_AttackPlayer::ExecuteTask(
 		if(!Enemy->bIsAttacking)
 		{
 			Enemy->AttackPlayer(PlayerCharacter);
-			return EBTNodeResult::Succeeded;
-		}
-		else
-		{
-			// Already attacking, fail to prevent repeated calls
-			return EBTNodeResult::Failed;
+
+			// Still on cooldown
+			if(!Enemy->bIsAttacking)
+			{
+				return EBTNodeResult::Succeeded;
+			}
 		}
+
+		// Finish when the attack (new or already running) ends
+		return WaitForAttack(OwnerComp, NodeMemory, Enemy);
 	}
 
 	return EBTNodeResult::Failed;
 }
+
+EBTNodeResult::Type UBTTask_AttackPlayer::WaitForAttack(
+	UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory, AMyEnemy *Enemy)
+{
+	FBTAttackPlayerMemory &Memory =
+		*CastInstanceNodeMemory<FBTAttackPlayerMemory>(NodeMemory);
+	Memory.Enemy = Enemy;
+	Memory.AttackFinishedHandle = Enemy->GetOnAttackFinished().AddUObject(this,
+		&UBTTask_AttackPlayer::OnAttackFinished,
+		TWeakObjectPtr<UBehaviorTreeComponent>(&OwnerComp));
+
+	// Stop waiting if the player is cleared (e.g. died) mid-attack
+	UBlackboardComponent *BlackboardComp = OwnerComp.GetBlackboardComponent();
+	if(BlackboardComp && PlayerKey.IsSet())
+	{
+		BlackboardComp->RegisterObserver(PlayerKey.GetSelectedKeyID(), this,
+			FOnBlackboardChangeNotification::CreateUObject(
+				this, &UBTTask_AttackPlayer::OnPlayerKeyChanged));
+	}
+
+	return EBTNodeResult::InProgress;
+}
+
+void UBTTask_AttackPlayer::OnTaskFinished(UBehaviorTreeComponent &OwnerComp,
+	uint8 *NodeMemory, EBTNodeResult::Type TaskResult)
+{
+	FBTAttackPlayerMemory &Memory =
+		*CastInstanceNodeMemory<FBTAttackPlayerMemory>(NodeMemory);
+	if(AMyEnemy *Enemy = Memory.Enemy.Get())
+	{
+		Enemy->GetOnAttackFinished().Remove(Memory.AttackFinishedHandle);
+	}
+	Memory.Enemy.Reset();
+	Memory.AttackFinishedHandle.Reset();
+
+	if(UBlackboardComponent *BlackboardComp =
+			OwnerComp.GetBlackboardComponent())
+	{
+		BlackboardComp->UnregisterObserversFrom(this);
+	}
+
+	Super::OnTaskFinished(OwnerComp, NodeMemory, TaskResult);
+}
+
+void UBTTask_AttackPlayer::OnAttackFinished(
+	TWeakObjectPtr<UBehaviorTreeComponent> OwnerComp)
+{
+	if(UBehaviorTreeComponent *BehaviorTreeComp = OwnerComp.Get())
+	{
+		FinishLatentTask(*BehaviorTreeComp, EBTNodeResult::Succeeded);
+	}
+}
+
+EBlackboardNotificationResult UBTTask_AttackPlayer::OnPlayerKeyChanged(
+	const UBlackboardComponent &Blackboard, FBlackboard::FKey ChangedKeyID)
+{
+	if(MyBlackboard::GetObject(&Blackboard, ChangedKeyID))
+	{
+		return EBlackboardNotificationResult::ContinueObserving;
+	}
+
+	if(UBehaviorTreeComponent *BehaviorTreeComp =
+			Cast<UBehaviorTreeComponent>(Blackboard.GetBrainComponent()))
+	{
+		FinishLatentTask(*BehaviorTreeComp, EBTNodeResult::Failed);
+	}
+	return EBlackboardNotificationResult::RemoveObserver;
+}
@@ -3,25 +3,60 @@
 #include "BTTask_FindPlayer.h"
 
 #include "AIController.h"
+#include "ActionRPG.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Engine/World.h"
 #include "GameFramework/Character.h"
-#include "Kismet/GameplayStatics.h"
 #include "Math/UnrealMathUtility.h"
+#include "MyBlackboardKeys.h"
 #include "MyEnemy.h"
-#include "NavigationSystem.h"
+#include "MyGameConfig.h"
+#include "MyPatrolPathSubsystem.h"
+#include "MyPerceptionSubsystem.h"
+#include "MyWanderPointSubsystem.h"
 #include "Navigation/PathFollowingComponent.h"
 
 UBTTask_FindPlayer::UBTTask_FindPlayer()
 {
 	NodeName = "Find Player";
 	bNotifyTick = true;
-	bHasTarget = false;
+	bNotifyTaskFinished = true;
+	bCreateNodeInstance = false;
+}
+
+void UBTTask_FindPlayer::InitializeFromAsset(UBehaviorTree &Asset)
+{
+	Super::InitializeFromAsset(Asset);
+
+	// Resolve the key ID once per tree asset; executions write by ID
+	if(const UBlackboardData *BlackboardAsset = GetBlackboardAsset())
+	{
+		PlayerKey.ResolveSelectedKey(*BlackboardAsset);
+	}
+}
+
+uint16 UBTTask_FindPlayer::GetInstanceMemorySize() const
+{
+	return sizeof(FBTFindPlayerMemory);
+}
+
+void UBTTask_FindPlayer::InitializeMemory(UBehaviorTreeComponent &OwnerComp,
+	uint8 *NodeMemory, EBTMemoryInit::Type InitType) const
+{
+	InitializeNodeMemory<FBTFindPlayerMemory>(NodeMemory, InitType);
+}
+
+void UBTTask_FindPlayer::CleanupMemory(UBehaviorTreeComponent &OwnerComp,
+	uint8 *NodeMemory, EBTMemoryClear::Type CleanupType) const
+{
+	CleanupNodeMemory<FBTFindPlayerMemory>(NodeMemory, CleanupType);
 }
 
 EBTNodeResult::Type UBTTask_FindPlayer::ExecuteTask(
 	UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory)
 {
+	INC_DWORD_STAT(STAT_BTTaskExecutions);
+
 	AAIController *AIController = OwnerComp.GetAIOwner();
 	if(!AIController)
 	{
@@ -41,45 +76,28 @@ EBTNodeResult::Type UBTTask_FindPlayer::ExecuteTask(
 		return EBTNodeResult::Failed;
 	}
 
-	// Find player character
-	ACharacter *PlayerCharacter =
-		UGameplayStatics::GetPlayerCharacter(AIController->GetWorld(), 0);
-	if(!PlayerCharacter)
+	UMyPerceptionSubsystem *Perception =
+		AIController->GetWorld()
+			? AIController->GetWorld()->GetSubsystem<UMyPerceptionSubsystem>()
+			: nullptr;
+	if(!Perception)
 	{
 		return EBTNodeResult::Failed;
 	}
 
-	// Check distance for detection
-	float Distance = FVector::Dist(AIController->GetPawn()->GetActorLocation(),
-		PlayerCharacter->GetActorLocation());
-	if(Distance > EnemyController->DetectionRange)
-	{
-		// Player not in range, start movement
-		StartMovement(AIController, Enemy);
-		return EBTNodeResult::InProgress;
-	}
-
-	// Check line of sight
-	UWorld *World = AIController->GetWorld();
-	if(!World)
+	// Visibility is traced by the perception subsystem; read the cache
+	const FMyPerceptionResult Result =
+		Perception->GetPerception(Enemy, EnemyController->DetectionRange);
+	if(!Result.bHasPlayers)
 	{
 		return EBTNodeResult::Failed;
 	}
 
-	FVector Start = AIController->GetPawn()->GetActorLocation();
-	FVector End = PlayerCharacter->GetActorLocation();
-
-	FHitResult HitResult;
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(AIController->GetPawn()); // Ignore self
-
-	bool bHit = World->LineTraceSingleByChannel(
-		HitResult, Start, End, ECC_Visibility, QueryParams);
-
-	if(bHit && HitResult.GetActor() != PlayerCharacter)
+	if(!Result.CanSeePlayer())
 	{
-		// Something is blocking the line of sight, continue movement
-		StartMovement(AIController, Enemy);
+		// Out of range or line of sight blocked, start movement
+		StartMovement(AIController, Enemy,
+			*CastInstanceNodeMemory<FBTFindPlayerMemory>(NodeMemory));
 		return EBTNodeResult::InProgress;
 	}
 
@@ -87,8 +105,8 @@ EBTNodeResult::Type UBTTask_FindPlayer::ExecuteTask(
 	UBlackboardComponent *BlackboardComp = OwnerComp.GetBlackboardComponent();
 	if(BlackboardComp)
 	{
-		BlackboardComp->SetValueAsObject(
-			PlayerKey.SelectedKeyName, PlayerCharacter);
+		MyBlackboard::SetObject(
+			BlackboardComp, PlayerKey.GetSelectedKeyID(), Result.Player);
 
 		return EBTNodeResult::Succeeded;
 	}
@@ -121,68 +139,80 @@ void UBTTask_FindPlayer::TickTask(
 		return;
 	}
 
-	// Find player character
-	ACharacter *PlayerCharacter =
-		UGameplayStatics::GetPlayerCharacter(AIController->GetWorld(), 0);
-	if(!PlayerCharacter)
+	UMyPerceptionSubsystem *Perception =
+		AIController->GetWorld()
+			? AIController->GetWorld()->GetSubsystem<UMyPerceptionSubsystem>()
+			: nullptr;
+	if(!Perception)
 	{
 		FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
 		return;
 	}
 
-	// Check distance for detection
-	float Distance = FVector::Dist(AIController->GetPawn()->GetActorLocation(),
-		PlayerCharacter->GetActorLocation());
-	if(Distance <= EnemyController->DetectionRange)
+	const FMyPerceptionResult Result =
+		Perception->GetPerception(Enemy, EnemyController->DetectionRange);
+	if(!Result.bHasPlayers)
 	{
-		// Check line of sight
-		UWorld *World = AIController->GetWorld();
-		if(World)
-		{
-			FVector Start = AIController->GetPawn()->GetActorLocation();
-			FVector End = PlayerCharacter->GetActorLocation();
-
-			FHitResult HitResult;
-			FCollisionQueryParams QueryParams;
-			QueryParams.AddIgnoredActor(AIController->GetPawn()); // Ignore self
+		FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
+		return;
+	}
 
-			bool bHit = World->LineTraceSingleByChannel(
-				HitResult, Start, End, ECC_Visibility, QueryParams);
+	if(Result.CanSeePlayer())
+	{
+		// Player detected, set in blackboard
+		UBlackboardComponent *BlackboardComp =
+			OwnerComp.GetBlackboardComponent();
+		if(BlackboardComp)
+		{
+			MyBlackboard::SetObject(
+				BlackboardComp, PlayerKey.GetSelectedKeyID(), Result.Player);
 
-			if(!bHit || HitResult.GetActor() == PlayerCharacter)
-			{
-				// Player detected, set in blackboard
-				UBlackboardComponent *BlackboardComp =
-					OwnerComp.GetBlackboardComponent();
-				if(BlackboardComp)
-				{
-					BlackboardComp->SetValueAsObject(
-						PlayerKey.SelectedKeyName, PlayerCharacter);
-					FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
-					return;
-				}
-			}
+			// OnTaskFinished drops any wander path still in flight
+			FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
+			return;
 		}
 	}
 
 	// Continue random movement
-	if(bHasTarget)
+	FBTFindPlayerMemory &Memory =
+		*CastInstanceNodeMemory<FBTFindPlayerMemory>(NodeMemory);
+	if(Memory.bHasTarget)
 	{
+		// Still idle while the async path query is in flight
 		EPathFollowingStatus::Type Status = AIController->GetMoveStatus();
-		if(Status == EPathFollowingStatus::Idle)
+		UMyWanderPointSubsystem *WanderPoints =
+			AIController->GetWorld()->GetSubsystem<UMyWanderPointSubsystem>();
+		if(Status == EPathFollowingStatus::Idle
+			&& !(WanderPoints && WanderPoints->IsMovePending(AIController)))
 		{
-			bHasTarget = false;
-			StartMovement(AIController, Enemy);
+			Memory.bHasTarget = false;
+			StartMovement(AIController, Enemy, Memory);
 		}
 	}
 	else
 	{
-		StartMovement(AIController, Enemy);
+		StartMovement(AIController, Enemy, Memory);
 	}
 }
 
-void UBTTask_FindPlayer::StartMovement(
-	AAIController *AIController, AMyEnemy *Enemy)
+void UBTTask_FindPlayer::OnTaskFinished(UBehaviorTreeComponent &OwnerComp,
+	uint8 *NodeMemory, EBTNodeResult::Type TaskResult)
+{
+	// Aborted or done: a late wander path must not move the pawn for
+	// whatever runs next
+	AAIController *AIController = OwnerComp.GetAIOwner();
+	UWorld *World = AIController ? AIController->GetWorld() : nullptr;
+	if(UMyWanderPointSubsystem *WanderPoints =
+			World ? World->GetSubsystem<UMyWanderPointSubsystem>() : nullptr)
+	{
+		WanderPoints->CancelWanderMove(AIController);
+	}
+
+	Super::OnTaskFinished(OwnerComp, NodeMemory, TaskResult);
+}
+
+void UBTTask_FindPlayer::StartMovement(AAIController *AIController,
+	AMyEnemy *Enemy, FBTFindPlayerMemory &Memory) const
 {
 	if(!AIController || !Enemy)
 	{
@@ -192,40 +222,66 @@ void UBTTask_FindPlayer::StartMovement(
 	if(Enemy->PatrolPoints.Num() > 0)
 	{
 		// Patrol mode: move to next patrol point
-		if(CurrentPatrolIndex >= Enemy->PatrolPoints.Num())
+		if(Memory.CurrentPatrolIndex >= Enemy->PatrolPoints.Num())
 		{
-			CurrentPatrolIndex = 0;
+			Memory.CurrentPatrolIndex = 0;
 		}
-		AActor *PatrolPoint = Enemy->PatrolPoints[CurrentPatrolIndex];
+		AActor *PatrolPoint = Enemy->PatrolPoints[Memory.CurrentPatrolIndex];
 		if(PatrolPoint)
 		{
-			CurrentTargetLocation = PatrolPoint->GetActorLocation();
-			bHasTarget = true;
-			AIController->MoveToLocation(CurrentTargetLocation);
-			CurrentPatrolIndex =
-				(CurrentPatrolIndex + 1) % Enemy->PatrolPoints.Num();
+			Memory.CurrentTargetLocation = PatrolPoint->GetActorLocation();
+			Memory.bHasTarget = true;
+
+			// Standing on the previous point: follow the shared cached leg
+			const AActor *FromPoint =
+				Enemy->PatrolPoints.IsValidIndex(Memory.LastPatrolIndex)
+					? Enemy->PatrolPoints[Memory.LastPatrolIndex]
+					: nullptr;
+			const bool bAtFromPoint =
+				FromPoint
+				&& FVector::Dist2D(FromPoint->GetActorLocation(),
+					   Enemy->GetActorLocation())
+					   <= FGameConfig::GetDefault().PatrolPointTolerance;
+			UMyPatrolPathSubsystem *PatrolPaths =
+				AIController->GetWorld()
+					->GetSubsystem<UMyPatrolPathSubsystem>();
+			const EMyPatrolMoveResult MoveResult =
+				bAtFromPoint && PatrolPaths
+					? PatrolPaths->RequestPatrolMove(
+						  AIController, FromPoint, PatrolPoint)
+					: EMyPatrolMoveResult::Pending;
+			if(MoveResult == EMyPatrolMoveResult::Pending)
+			{
+				AIController->MoveToLocation(Memory.CurrentTargetLocation);
+			}
+
+			// Skip unreachable points; the next leg starts where we stand
+			if(MoveResult != EMyPatrolMoveResult::Unreachable)
+			{
+				Memory.LastPatrolIndex = Memory.CurrentPatrolIndex;
+			}
+			Memory.CurrentPatrolIndex =
+				(Memory.CurrentPatrolIndex + 1) % Enemy->PatrolPoints.Num();
 		}
 	}
 	else
 	{
-		// Random movement mode
-		UNavigationSystemV1 *NavSys =
-			UNavigationSystemV1::GetCurrent(AIController->GetWorld());
-		if(!NavSys)
+		// Random movement mode: cached wander point, path found async
+		UMyWanderPointSubsystem *WanderPoints =
+			AIController->GetWorld()
+				? AIController->GetWorld()
+					  ->GetSubsystem<UMyWanderPointSubsystem>()
+				: nullptr;
+		if(!WanderPoints)
 		{
 			return;
 		}
 
-		FVector Origin = AIController->GetPawn()->GetActorLocation();
-		FNavLocation RandomLocation;
-
-		// Find random reachable point within 1000 units
-		if(NavSys->GetRandomReachablePointInRadius(
-			   Origin, 1000.0f, RandomLocation))
+		if(WanderPoints->RequestWanderMove(AIController,
+			   FGameConfig::GetDefault().WanderRadius,
+			   Memory.CurrentTargetLocation))
 		{
-			CurrentTargetLocation = RandomLocation.Location;
-			bHasTarget = true;
-			AIController->MoveToLocation(CurrentTargetLocation);
+			Memory.bHasTarget = true;
 		}
 	}
 }
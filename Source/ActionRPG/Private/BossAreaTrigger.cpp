@@ -20,6 +20,16 @@ ABossAreaTrigger::ABossAreaTrigger()
 
 	TriggerBox->OnComponentBeginOverlap.AddDynamic(
 		this, &ABossAreaTrigger::OnOverlapBegin);
+
+	PrewarmBox = CreateDefaultSubobject<UBoxComponent>(TEXT("PrewarmBox"));
+	PrewarmBox->SetupAttachment(TriggerBox);
+	PrewarmBox->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	PrewarmBox->SetCollisionObjectType(ECC_WorldDynamic);
+	PrewarmBox->SetCollisionResponseToAllChannels(ECR_Ignore);
+	PrewarmBox->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+
+	PrewarmBox->OnComponentBeginOverlap.AddDynamic(
+		this, &ABossAreaTrigger::OnPrewarmOverlapBegin);
 }
 
 void ABossAreaTrigger::BeginPlay()
@@ -27,6 +37,31 @@ void ABossAreaTrigger::BeginPlay()
 	Super::BeginPlay();
 }
 
+void ABossAreaTrigger::OnConstruction(const FTransform &Transform)
+{
+	Super::OnConstruction(Transform);
+
+	// The pre-warm volume follows the trigger's size; the margin is in world
+	// units, so undo the trigger scale it inherits
+	const FVector TriggerScale = TriggerBox->GetComponentScale().ComponentMax(
+		FVector(UE_KINDA_SMALL_NUMBER));
+	PrewarmBox->SetBoxExtent(TriggerBox->GetUnscaledBoxExtent()
+							 + FVector(PrewarmDistance) / TriggerScale);
+}
+
+void ABossAreaTrigger::OnPrewarmOverlapBegin(
+	UPrimitiveComponent *OverlappedComp, AActor *OtherActor,
+	UPrimitiveComponent *OtherComp, int32 OtherBodyIndex, bool bFromSweep,
+	const FHitResult &SweepResult)
+{
+	AMyBoss *Boss = BossToActivate.Get();
+	if(Boss && Cast<AMyCharacter>(OtherActor))
+	{
+		// Stream montages and meshes in before the player reaches the boss
+		Boss->PrewarmAssets();
+	}
+}
+
 void ABossAreaTrigger::OnOverlapBegin(UPrimitiveComponent *OverlappedComp,
 	AActor *OtherActor, UPrimitiveComponent *OtherComp, int32 OtherBodyIndex,
 	bool bFromSweep, const FHitResult &SweepResult)
@@ -43,6 +78,9 @@ void ABossAreaTrigger::OnOverlapBegin(UPrimitiveComponent *OverlappedComp,
 		&& !BossToActivate.Get()->IsTemplate()
 		&& !BossToActivate.Get()->HasAnyFlags(RF_ClassDefaultObject))
 	{
+		// Normally already streamed in by the pre-warm volume
+		BossToActivate.Get()->PrewarmAssets();
+
 		// Activate boss
 		BossToActivate.Get()->SetActorHiddenInGame(false);
 		BossToActivate.Get()->SetActorEnableCollision(true);
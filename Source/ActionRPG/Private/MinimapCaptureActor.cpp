@@ -1,8 +1,9 @@
 #include "MinimapCaptureActor.h"
 #include "Engine/TextureRenderTarget2D.h"
 #include "Components/SceneCaptureComponent2D.h"
+#include "GameFramework/Character.h"
 #include "TimerManager.h"
-#include "Kismet/GameplayStatics.h"
+#include "MyPlayerRegistrySubsystem.h"
 
 AMinimapCaptureActor::AMinimapCaptureActor()
 {
@@ -46,7 +47,10 @@ void AMinimapCaptureActor::UpdateCapture()
 	if(SceneCaptureComponent && RenderTarget)
 	{
 		// Follow player position
-		APawn *PlayerPawn = UGameplayStatics::GetPlayerPawn(this, 0);
+		const UMyPlayerRegistrySubsystem *PlayerRegistry =
+			GetWorld()->GetSubsystem<UMyPlayerRegistrySubsystem>();
+		APawn *PlayerPawn =
+			PlayerRegistry ? PlayerRegistry->GetLocalPlayer() : nullptr;
 		if(PlayerPawn)
 		{
 			FVector PlayerLocation = PlayerPawn->GetActorLocation();
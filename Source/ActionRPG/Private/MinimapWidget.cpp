@@ -1,7 +1,6 @@
 #include "MinimapWidget.h"
 #include "Components/Image.h"
 #include "Engine/TextureRenderTarget2D.h"
-#include "Kismet/GameplayStatics.h"
 #include "GameFramework/Character.h"
 #include "Components/CanvasPanelSlot.h"
 
@@ -27,7 +26,7 @@ void UMinimapWidget::UpdatePlayerMarker()
 	if(!PlayerMarker || !MinimapImage)
 		return;
 
-	ACharacter *PlayerCharacter = UGameplayStatics::GetPlayerCharacter(this, 0);
+	ACharacter *PlayerCharacter = Cast<ACharacter>(GetOwningPlayerPawn());
 	if(!PlayerCharacter)
 		return;
 
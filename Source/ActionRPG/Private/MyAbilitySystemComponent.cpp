@@ -0,0 +1,129 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyAbilitySystemComponent.h"
+
+#include "MyAttackAbility.h"
+#include "MyGameplayTags.h"
+
+FGameplayEffectSpecHandle UMyAbilitySystemComponent::GetCachedDamageSpec(
+	TSubclassOf<UGameplayEffect> EffectClass, float Level)
+{
+	if(!EffectClass)
+	{
+		return FGameplayEffectSpecHandle();
+	}
+
+	const FMyDamageSpecKey Key{EffectClass.Get(), Level};
+	if(FCachedDamageSpec *Cached = DamageSpecCache.Find(Key))
+	{
+		if(Cached->Serial != DamageSpecSerial)
+		{
+			// Tags or attributes may have changed since the last refresh
+			Cached->Spec.Data->CaptureDataFromSource();
+			Cached->Serial = DamageSpecSerial;
+		}
+		return Cached->Spec;
+	}
+
+	FGameplayEffectSpecHandle SpecHandle =
+		MakeOutgoingSpec(EffectClass, Level, MakeEffectContext());
+	if(SpecHandle.IsValid())
+	{
+		DamageSpecCache.Add(Key, {SpecHandle, DamageSpecSerial});
+	}
+	return SpecHandle;
+}
+
+FActiveGameplayEffectHandle UMyAbilitySystemComponent::ApplyCachedDamageSpec(
+	TSubclassOf<UGameplayEffect> EffectClass, float Level, float Damage,
+	UAbilitySystemComponent *Target)
+{
+	if(!Target)
+	{
+		return FActiveGameplayEffectHandle();
+	}
+
+	FGameplayEffectSpecHandle SpecHandle =
+		GetCachedDamageSpec(EffectClass, Level);
+	if(!SpecHandle.IsValid())
+	{
+		return FActiveGameplayEffectHandle();
+	}
+
+	// Only the magnitude changes between hits; the tag entry already exists
+	// after the first hit. Applying still copies the spec for the target
+	// (the engine's own per-application cost); the cache saves building
+	// the spec, its context and its attribute captures each hit.
+	SpecHandle.Data->SetSetByCallerMagnitude(DataTags::Damage, -Damage);
+
+	return ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), Target);
+}
+
+void UMyAbilitySystemComponent::NotifyAbilityActivated(
+	const FGameplayAbilitySpecHandle Handle, UGameplayAbility *Ability)
+{
+	Super::NotifyAbilityActivated(Handle, Ability);
+
+	// Activations can grant tags the next hits should carry
+	RefreshDamageSpecs();
+
+	if(UMyAttackAbility *AttackAbility = Cast<UMyAttackAbility>(Ability))
+	{
+		SetActiveAttackAbility(AttackAbility);
+	}
+}
+
+void UMyAbilitySystemComponent::NotifyAbilityEnded(
+	FGameplayAbilitySpecHandle Handle, UGameplayAbility *Ability,
+	bool bWasCancelled)
+{
+	Super::NotifyAbilityEnded(Handle, Ability, bWasCancelled);
+
+	if(Ability && Ability == ActiveAttackAbility)
+	{
+		SetActiveAttackAbility(nullptr);
+	}
+}
+
+void UMyAbilitySystemComponent::OnGiveAbility(
+	FGameplayAbilitySpec &AbilitySpec)
+{
+	Super::OnGiveAbility(AbilitySpec);
+
+	if(AbilitySpec.Ability && AbilitySpec.Ability->IsA<UMyAttackAbility>())
+	{
+		NumGrantedAttackAbilities++;
+	}
+}
+
+void UMyAbilitySystemComponent::OnRemoveAbility(
+	FGameplayAbilitySpec &AbilitySpec)
+{
+	if(AbilitySpec.Ability && AbilitySpec.Ability->IsA<UMyAttackAbility>())
+	{
+		NumGrantedAttackAbilities =
+			FMath::Max(NumGrantedAttackAbilities - 1, 0);
+
+		// Don't let the cached instance outlive its spec
+		if(ActiveAttackAbility
+			&& ActiveAttackAbility->GetCurrentAbilitySpecHandle()
+				   == AbilitySpec.Handle)
+		{
+			SetActiveAttackAbility(nullptr);
+		}
+	}
+
+	Super::OnRemoveAbility(AbilitySpec);
+}
+
+void UMyAbilitySystemComponent::SetActiveAttackAbility(
+	UMyAttackAbility *NewAbility)
+{
+	if(ActiveAttackAbility == NewAbility)
+	{
+		return;
+	}
+
+	ActiveAttackAbility = NewAbility;
+	OnActiveAttackAbilityChanged.Broadcast(ActiveAttackAbility);
+}
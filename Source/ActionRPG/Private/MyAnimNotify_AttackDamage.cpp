@@ -2,42 +2,26 @@
 
 #include "MyAnimNotify_AttackDamage.h"
 
-#include "AbilitySystemComponent.h"
 #include "Engine/World.h"
-#include "GameFramework/Character.h"
-#include "GameFramework/CharacterMovementComponent.h"
-#include "GameplayEffect.h"
-#include "Kismet/GameplayStatics.h"
-#include "MyAttackAbility.h"
-#include "MyCharacter.h"
-#include "MyDamageEffect.h"
-#include "MyEnemy.h"
-#include "NiagaraFunctionLibrary.h"
-#include "NiagaraSystem.h"
+#include "MyBaseCharacter.h"
+#include "MyHitHistorySubsystem.h"
+#include "MyHitQuerySubsystem.h"
+#include "MyHurtboxComponent.h"
+#include "MyWeaponTrajectoryAsset.h"
 
 UMyAnimNotify_AttackDamage::UMyAnimNotify_AttackDamage()
 {
 }
 
-void UMyAnimNotify_AttackDamage::Notify(USkeletalMeshComponent *MeshComp,
-	UAnimSequenceBase *Animation,
-	const FAnimNotifyEventReference &EventReference)
+void UMyAnimNotify_AttackDamage::HandleNotify(
+	AActor *Owner, const UAnimMontage *Montage, float Position)
 {
-	if(!MeshComp)
-	{
-		return;
-	}
-
-	AActor *OwnerActor = MeshComp->GetOwner();
-	if(!OwnerActor || !OwnerActor->IsValidLowLevel())
-	{
-		return;
-	}
-
-	PerformTraceAndApplyDamage(OwnerActor);
+	// Montage time drives the baked weapon path
+	PerformTraceAndApplyDamage(Owner, Montage, Position);
 }
 
-void UMyAnimNotify_AttackDamage::PerformTraceAndApplyDamage(AActor *OwnerActor)
+void UMyAnimNotify_AttackDamage::PerformTraceAndApplyDamage(
+	AActor *OwnerActor, const UAnimMontage *Montage, float Position)
 {
 	UWorld *World = OwnerActor->GetWorld();
 	if(!World)
@@ -45,126 +29,90 @@ void UMyAnimNotify_AttackDamage::PerformTraceAndApplyDamage(AActor *OwnerActor)
 		return;
 	}
 
-	ACharacter *Character = Cast<ACharacter>(OwnerActor);
-	if(!Character)
+	UMyHitQuerySubsystem *HitQuery =
+		World->GetSubsystem<UMyHitQuerySubsystem>();
+	AMyBaseCharacter *Character = Cast<AMyBaseCharacter>(OwnerActor);
+	if(!HitQuery || !Character || !Character->GetHurtboxComponent())
 	{
 		return;
 	}
 
-	UAbilitySystemComponent *ASC = nullptr;
-	if(AMyCharacter *MyChar = Cast<AMyCharacter>(Character))
+	FMyAttackSweepRequest Request;
+	Request.Attacker = OwnerActor;
+	Request.TargetChannel =
+		Character->GetHurtboxComponent()->GetOpposingChannel();
+	Request.DamageAmount = DamageAmount;
+	Request.DamageEffectClass = DamageEffectClass;
+
+	// On the server, validate remote players' swings against the poses
+	// their client saw
+	if(UMyHitHistorySubsystem *HitHistory =
+			World->GetSubsystem<UMyHitHistorySubsystem>())
 	{
-		ASC = MyChar->GetAbilitySystem();
+		Request.RewindTime = HitHistory->GetClientViewTime(OwnerActor);
 	}
-	// Enemy doesn't use GAS for attacks
 
-	// Calculate trace start and end
-	FVector StartLocation =
-		OwnerActor->GetActorLocation()
-		+ OwnerActor->GetActorRotation().RotateVector(TraceOffset);
-	FVector EndLocation =
-		StartLocation + OwnerActor->GetActorForwardVector() * TraceLength;
-
-	// Perform sphere trace
-	TArray<FHitResult> HitResults;
-	FCollisionShape SphereShape = FCollisionShape::MakeSphere(TraceRadius);
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(OwnerActor); // Ignore self
-
-	bool bHit = World->SweepMultiByChannel(HitResults, StartLocation,
-		EndLocation, FQuat::Identity, ECC_Pawn, SphereShape, QueryParams);
+	// Prefer the baked weapon path; no bone transforms are evaluated
+	const FMyMontageTrajectory *Trajectory =
+		Character->WeaponTrajectories
+			? Character->WeaponTrajectories->FindTrajectory(Montage)
+			: nullptr;
+	if(Trajectory)
+	{
+		QueueTrajectorySweeps(
+			*HitQuery, *Character, Request, *Trajectory, Position);
+		return;
+	}
 
-	bool bSpawnedParticle = false;
+	// Calculate trace start and end
+	Request.Start = OwnerActor->GetActorLocation()
+					+ OwnerActor->GetActorRotation().RotateVector(TraceOffset);
+	Request.End =
+		Request.Start + OwnerActor->GetActorForwardVector() * TraceLength;
+	Request.Radius = TraceRadius;
+
+	// The sweep runs asynchronously; hits are applied next frame
+	HitQuery->EnqueueAttackSweep(Request);
+}
 
-	if(bHit)
+void UMyAnimNotify_AttackDamage::QueueTrajectorySweeps(
+	UMyHitQuerySubsystem &HitQuery, const AMyBaseCharacter &Character,
+	FMyAttackSweepRequest Request, const FMyMontageTrajectory &Trajectory,
+	float Position) const
+{
+	const TArray<FMyTrajectorySample> &Samples = Trajectory.Samples;
+	const float Interval = Trajectory.SampleInterval;
+
+	// Baked frames covering [Position - TrajectoryWindow, Position]
+	const int32 Last = FMath::Clamp(
+		FMath::CeilToInt32(Position / Interval), 1, Samples.Num() - 1);
+	const int32 First = FMath::Clamp(
+		FMath::FloorToInt32((Position - TrajectoryWindow) / Interval), 0,
+		Last - 1);
+
+	// The segments form one swing and hit at most one target
+	Request.SweepGroup = HitQuery.AllocateSweepGroup();
+	Request.Radius = Trajectory.Radius;
+
+	const FTransform ActorTransform = Character.GetActorTransform();
+	for(int32 Index = First; Index < Last; ++Index)
 	{
-		for(const FHitResult &Hit : HitResults)
-		{
-			AActor *HitActor = Hit.GetActor();
-
-			if(HitActor
-				&& (HitActor->IsA(AMyCharacter::StaticClass())
-					|| HitActor->IsA(AMyEnemy::StaticClass())))
-			{
-
-				// Apply damage
-				if(AMyEnemy *Enemy = Cast<AMyEnemy>(HitActor))
-				{
-					// For Enemy, use simple damage
-					UGameplayStatics::ApplyDamage(
-						Enemy, DamageAmount, nullptr, OwnerActor, nullptr);
-
-					// Apply knockback to prevent overlap
-					if(UCharacterMovementComponent *Movement =
-							Enemy->GetCharacterMovement())
-					{
-						FVector KnockbackDirection =
-							(Enemy->GetActorLocation()
-								- OwnerActor->GetActorLocation())
-								.GetSafeNormal();
-						Movement->AddImpulse(
-							KnockbackDirection
-								* FGameConfig::GetDefault().KnockbackForce,
-							true);
-					}
-				}
-				else if(AMyCharacter *Player = Cast<AMyCharacter>(HitActor))
-				{
-					// For Player, use GAS
-					UAbilitySystemComponent *TargetASC =
-						Player->GetAbilitySystem();
-					if(TargetASC)
-					{
-						TSubclassOf<UGameplayEffect> EffectToUse =
-							DamageEffectClass
-								? DamageEffectClass
-								: TSubclassOf<UGameplayEffect>(
-									  UMyDamageEffect::StaticClass());
-
-						FGameplayEffectSpecHandle SpecHandle =
-							TargetASC->MakeOutgoingSpec(EffectToUse, 1.0f,
-								FGameplayEffectContextHandle());
-						if(SpecHandle.IsValid())
-						{
-							SpecHandle.Data->SetSetByCallerMagnitude(
-								FGameplayTag::RequestGameplayTag(
-									FName("Data.Damage")),
-								-DamageAmount);
-
-							TargetASC->ApplyGameplayEffectSpecToTarget(
-								*SpecHandle.Data.Get(), TargetASC);
-						}
-					}
-				}
-
-				// Spawn particle effect if from active attack ability
-				if(!bSpawnedParticle && ASC)
-				{
-					TArray<FGameplayAbilitySpec> Specs =
-						ASC->GetActivatableAbilities();
-					for(const FGameplayAbilitySpec &Spec : Specs)
-					{
-						if(Spec.IsActive()
-							&& Spec.Ability->IsA(
-								UMyAttackAbility::StaticClass()))
-						{
-							UMyAttackAbility *AttackAbility =
-								Cast<UMyAttackAbility>(Spec.Ability);
-							if(AttackAbility
-								&& AttackAbility->AttackParticleEffect)
-							{
-								UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-									World, AttackAbility->AttackParticleEffect,
-									Hit.Location, FRotator::ZeroRotator);
-								bSpawnedParticle = true;
-								break;
-							}
-						}
-					}
-				}
-
-				break; // Apply to first hit
-			}
-		}
+		const FVector BladeStart =
+			ActorTransform.TransformPosition(FVector(Samples[Index].Start));
+		const FVector BladeEnd =
+			ActorTransform.TransformPosition(FVector(Samples[Index].End));
+		const FVector NextStart = ActorTransform.TransformPosition(
+			FVector(Samples[Index + 1].Start));
+		const FVector NextEnd = ActorTransform.TransformPosition(
+			FVector(Samples[Index + 1].End));
+
+		// Move the blade capsule from this frame to the next
+		const FVector Blade = BladeEnd - BladeStart;
+		Request.Start = (BladeStart + BladeEnd) * 0.5f;
+		Request.End = (NextStart + NextEnd) * 0.5f;
+		Request.Rotation = FRotationMatrix::MakeFromZ(Blade).ToQuat();
+		Request.HalfHeight = Blade.Size() * 0.5f + Trajectory.Radius;
+
+		HitQuery.EnqueueAttackSweep(Request);
 	}
 }
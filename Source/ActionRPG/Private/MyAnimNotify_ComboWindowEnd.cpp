@@ -2,8 +2,6 @@
 
 #include "MyAnimNotify_ComboWindowEnd.h"
 
-#include "AbilitySystemComponent.h"
-#include "GameFramework/Character.h"
 #include "MyAttackAbility.h"
 #include "MyCharacter.h"
 
@@ -11,49 +9,19 @@ UMyAnimNotify_ComboWindowEnd::UMyAnimNotify_ComboWindowEnd()
 {
 }
 
-void UMyAnimNotify_ComboWindowEnd::Notify(
-	USkeletalMeshComponent *MeshComp, UAnimSequenceBase *Animation)
+void UMyAnimNotify_ComboWindowEnd::HandleNotify(
+	AActor *Owner, const UAnimMontage *Montage, float Position)
 {
-	if(!MeshComp)
-	{
-		return;
-	}
-
-	ACharacter *Character = Cast<ACharacter>(MeshComp->GetOwner());
-	if(!Character)
-	{
-		return;
-	}
-
-	AMyCharacter *MyCharacter = Cast<AMyCharacter>(Character);
+	AMyCharacter *MyCharacter = Cast<AMyCharacter>(Owner);
 	if(!MyCharacter)
 	{
 		return;
 	}
 
 	// Get the current attack ability and end combo window
-	if(UAbilitySystemComponent *ASC = MyCharacter->GetAbilitySystem())
+	if(UMyAttackAbility *AttackAbility = MyCharacter->GetActiveAttackAbility())
 	{
-		// Find the active attack ability
-		TArray<FGameplayAbilitySpec> Abilities = ASC->GetActivatableAbilities();
-		for(const FGameplayAbilitySpec &Spec : Abilities)
-		{
-			if(Spec.Ability
-				&& Spec.Ability->GetClass()->IsChildOf(
-					UMyAttackAbility::StaticClass()))
-			{
-				if(Spec.IsActive())
-				{
-					UMyAttackAbility *AttackAbility =
-						Cast<UMyAttackAbility>(Spec.GetPrimaryInstance());
-					if(AttackAbility)
-					{
-						// End combo window
-						AttackAbility->EndComboWindow();
-						break;
-					}
-				}
-			}
-		}
+		// End combo window
+		AttackAbility->EndComboWindow();
 	}
 }
@@ -4,6 +4,7 @@
 
 #include "Abilities/GameplayAbilityTargetTypes.h"
 #include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
 #include "Animation/AnimMontage.h"
 #include "Engine/EngineTypes.h"
 #include "Engine/OverlapResult.h"
@@ -11,8 +12,13 @@
 #include "GameFramework/Character.h"
 #include "GameplayEffect.h"
 #include "GameplayEffectTypes.h"
+#include "MyAbilitySystemComponent.h"
 #include "MyDamageEffect.h"
 #include "MyEnemy.h"
+#include "MyGameplayTags.h"
+#include "MyHurtboxComponent.h"
+#include "MyImpactFXSubsystem.h"
+#include "MyMontageTimelineSubsystem.h"
 #include "WorldCollision.h"
 
 UMyAttackAbility::UMyAttackAbility()
@@ -47,6 +53,27 @@ void UMyAttackAbility::EndAbility(const FGameplayAbilitySpecHandle Handle,
 		Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
 
+void UMyAttackAbility::OnGiveAbility(const FGameplayAbilityActorInfo *ActorInfo,
+	const FGameplayAbilitySpec &Spec)
+{
+	Super::OnGiveAbility(ActorInfo, Spec);
+
+	// Pre-warm the impact pool so the first hits don't create components
+	AActor *Avatar = ActorInfo ? ActorInfo->AvatarActor.Get() : nullptr;
+	UWorld *World = Avatar ? Avatar->GetWorld() : nullptr;
+	if(!AttackParticleEffect || !World)
+	{
+		return;
+	}
+
+	if(UMyImpactFXSubsystem *ImpactFX =
+			World->GetSubsystem<UMyImpactFXSubsystem>())
+	{
+		ImpactFX->PrewarmEffect(AttackParticleEffect,
+			FGameConfig::GetDefault().ImpactFXPrewarmCount);
+	}
+}
+
 void UMyAttackAbility::OnAttackInputPressed()
 {
 	if(CanCombo())
@@ -127,7 +154,8 @@ void UMyAttackAbility::PlayAttackMontage()
 	UAnimMontage *Montage = AttackMontages[CurrentComboIndex];
 
 	AnimInstance->Montage_Stop(0.0f);
-	float Duration = AnimInstance->Montage_Play(Montage);
+	const float PlayRate = 1.0f;
+	float Duration = AnimInstance->Montage_Play(Montage, PlayRate);
 
 	if(Duration > 0.f)
 	{
@@ -135,6 +163,13 @@ void UMyAttackAbility::PlayAttackMontage()
 		MontageEndedDelegate.BindUObject(
 			this, &UMyAttackAbility::OnMontageEnded);
 		AnimInstance->Montage_SetEndDelegate(MontageEndedDelegate, Montage);
+
+		// Fire its notifies without pose evaluation on servers
+		if(UMyMontageTimelineSubsystem *Timeline =
+				GetWorld()->GetSubsystem<UMyMontageTimelineSubsystem>())
+		{
+			Timeline->StartMontage(Character, Montage, PlayRate);
+		}
 	}
 }
 
@@ -162,21 +197,30 @@ void UMyAttackAbility::ApplyDamageEffect()
 	AActor *Target = FindTargetInRange();
 	if(Target)
 	{
-		// Apply to target
+		// Reuse the prepared spec for this effect and level; other ability
+		// systems get a fresh spec per hit
+		const float Level = GetAbilityLevel(Handle, ActorInfo);
+		UAbilitySystemComponent *SourceASC =
+			GetAbilitySystemComponentFromActorInfo();
+		UMyAbilitySystemComponent *ASC =
+			Cast<UMyAbilitySystemComponent>(SourceASC);
 		FGameplayEffectSpecHandle DamageSpecHandle =
-			GetAbilitySystemComponentFromActorInfo()->MakeOutgoingSpec(
-				DamageEffectToUse, GetAbilityLevel(Handle, ActorInfo),
-				FGameplayEffectContextHandle());
-		if(DamageSpecHandle.IsValid())
+			ASC ? ASC->GetCachedDamageSpec(DamageEffectToUse, Level)
+				: MakeOutgoingGameplayEffectSpec(Handle, ActorInfo,
+					  ActivationInfo, DamageEffectToUse, Level);
+		UAbilitySystemComponent *TargetASC =
+			UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Target);
+		if(DamageSpecHandle.IsValid() && TargetASC
+			&& HasAuthorityOrPredictionKey(ActorInfo, &ActivationInfo))
 		{
-			// Create target data
-			FGameplayAbilityTargetData_SingleTargetHit *TargetData =
-				new FGameplayAbilityTargetData_SingleTargetHit();
-			TargetData->HitResult = FHitResult(
-				Target, nullptr, FVector::ZeroVector, FVector::ZeroVector);
-			// Apply to target
-			ApplyGameplayEffectSpecToTarget(Handle, ActorInfo, ActivationInfo,
-				DamageSpecHandle, TargetData);
+			DamageSpecHandle.Data->SetSetByCallerMagnitude(
+				DataTags::Damage, -DamageAmount);
+
+			// Apply straight to the target's ability system. Going through
+			// target data would duplicate the effect context every hit only
+			// to add an empty hit result.
+			SourceASC->ApplyGameplayEffectSpecToTarget(*DamageSpecHandle.Data,
+				TargetASC, SourceASC->ScopedPredictionKey);
 		}
 	}
 	else
@@ -190,34 +234,38 @@ void UMyAttackAbility::ApplyDamageEffect()
 
 AActor *UMyAttackAbility::FindTargetInRange()
 {
-	ACharacter *Character =
-		Cast<ACharacter>(GetCurrentActorInfo()->OwnerActor.Get());
-	if(!Character)
+	AMyBaseCharacter *Character =
+		Cast<AMyBaseCharacter>(GetCurrentActorInfo()->OwnerActor.Get());
+	if(!Character || !Character->GetHurtboxComponent())
 	{
 		return nullptr;
 	}
 
 	FVector Location = Character->GetActorLocation();
 
+	// Only the opposing team's hurtboxes can overlap
+	FCollisionQueryParams QueryParams;
+	QueryParams.AddIgnoredActor(Character);
+
 	TArray<FOverlapResult> OverlapResults;
 	FCollisionShape Sphere = FCollisionShape::MakeSphere(AttackRange);
-	GetWorld()->OverlapMultiByChannel(
-		OverlapResults, Location, FQuat::Identity, ECC_Pawn, Sphere);
-
-	for(const FOverlapResult &Result : OverlapResults)
-	{
-		AActor *Actor = Result.GetActor();
-		if(Actor && Actor != Character && Actor->IsA(AMyEnemy::StaticClass()))
-		{
-			return Actor;
-		}
-	}
+	GetWorld()->OverlapMultiByObjectType(OverlapResults, Location,
+		FQuat::Identity,
+		FCollisionObjectQueryParams(
+			Character->GetHurtboxComponent()->GetOpposingChannel()),
+		Sphere, QueryParams);
 
-	return nullptr;
+	return OverlapResults.Num() > 0 ? OverlapResults[0].GetActor() : nullptr;
 }
 
 void UMyAttackAbility::OnMontageEnded(UAnimMontage *Montage, bool bInterrupted)
 {
+	if(UMyMontageTimelineSubsystem *Timeline =
+			GetWorld()->GetSubsystem<UMyMontageTimelineSubsystem>())
+	{
+		Timeline->StopMontage(GetAvatarActorFromActorInfo(), Montage);
+	}
+
 	if(!bInterrupted)
 	{
 		if(bComboQueued)
@@ -10,6 +10,7 @@
 #include "MyAbilitySystemComponent.h"
 #include "MyBaseCharacter.h"
 #include "MyAttributeSet.h"
+#include "MyDefaultAttributesEffect.h"
 #include "MyGameplayAbility.h"
 
 UMyAttributeComponent::UMyAttributeComponent()
@@ -34,47 +35,47 @@ void UMyAttributeComponent::OnRegister()
 	{
 		AbilitySystemComponent->RegisterComponent();
 	}
+
+	// Components created at runtime register with an initialized owner
+	TryInitializeAbilitySystem();
 }
 
 void UMyAttributeComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Always defer GAS initialization to ensure proper timing
-	GetWorld()->GetTimerManager().SetTimerForNextTick(
-		this, &UMyAttributeComponent::DeferredInitialize);
+	// Components registered before their owner was initialized
+	TryInitializeAbilitySystem();
 }
 
-void UMyAttributeComponent::DeferredInitialize()
+bool UMyAttributeComponent::TryInitializeAbilitySystem()
 {
-	// Don't initialize on default objects or templates
-	if(!ValidateOwner())
+	if(bAbilitySystemInitialized)
 	{
-		return;
+		return true;
 	}
 
-	if(!IsReadyForInitialization())
+	// Not ready yet: the next initialization event tries again
+	if(!IsReadyForInitialization() || !TryInitializeAbilityActorInfo())
 	{
-		ScheduleRetryInitialization();
-		return;
-	}
-
-	if(!TryInitializeAbilityActorInfo())
-	{
-		HandleInitializationRetry();
-		return;
+		return false;
 	}
 
 	InitializeGASComponents();
+	bAbilitySystemInitialized = true;
+	InitializeAbilitySystem();
+	return true;
+}
 
-	if(IsAbilityActorInfoValid())
-	{
-		InitializeAbilitySystem();
-	}
-	else
+void UMyAttributeComponent::RefreshAbilityActorInfo()
+{
+	if(!TryInitializeAbilitySystem())
 	{
-		HandleInitializationRetry();
+		return;
 	}
+
+	// Pick up the new controller in the actor info
+	AbilitySystemComponent->RefreshAbilityActorInfo();
 }
 
 bool UMyAttributeComponent::IsReadyForInitialization() const
@@ -82,12 +83,6 @@ bool UMyAttributeComponent::IsReadyForInitialization() const
 	return ValidateOwner() && IsAbilitySystemComponentRegistered();
 }
 
-void UMyAttributeComponent::ScheduleRetryInitialization()
-{
-	GetWorld()->GetTimerManager().SetTimerForNextTick(
-		this, &UMyAttributeComponent::DeferredInitialize);
-}
-
 bool UMyAttributeComponent::ValidateOwner() const
 {
 	AActor *Owner = GetOwner();
@@ -149,63 +144,93 @@ bool UMyAttributeComponent::TryInitializeAbilityActorInfo()
 	return true;
 }
 
-void UMyAttributeComponent::HandleInitializationRetry()
+void UMyAttributeComponent::InitializeDefaultAttributes()
 {
-	static int32 RetryCount = 0;
-	if(RetryCount < FGameConfig::GetDefault().MaxInitializationRetries)
+	if(!IsAbilitySystemValid() || !AttributeSet)
 	{
-		RetryCount++;
-		ScheduleRetryInitialization();
+		return;
 	}
-	else
+
+	// Bind to health change delegate on the owner character
+	if(AMyBaseCharacter *Character = Cast<AMyBaseCharacter>(GetOwner()))
 	{
+		GetOnHealthChanged().AddUObject(
+			Character, &AMyBaseCharacter::OnHealthChanged);
 	}
+
+	ApplyDefaultAttributeValues();
 }
 
-void UMyAttributeComponent::InitializeAttributeComponent()
+void UMyAttributeComponent::ApplyDefaultAttributeValues()
 {
-	// Initialize attribute component if it exists
-	if(this)
+	if(!IsAbilitySystemValid() || !AttributeSet)
 	{
-		// Defer initialization to ensure proper timing
-		GetWorld()->GetTimerManager().SetTimerForNextTick(
-			this, &UMyAttributeComponent::InitializeDefaultAttributes);
+		return;
 	}
+
+	// Always apply component properties to override attributes
+	ApplyAttributeValues(GetDefaultAttributes());
 }
 
-void UMyAttributeComponent::InitializeDefaultAttributes()
+void UMyAttributeComponent::ApplyAttributeValues(
+	const FDefaultAttributes &Attributes)
+{
+	const FGameConfig &Config = FGameConfig::GetDefault();
+	const auto OrDefault = [](float Value, float Default) {
+		return Value > 0.0f ? Value : Default;
+	};
+
+	FGameplayEffectSpecHandle SpecHandle =
+		AbilitySystemComponent->MakeOutgoingSpec(
+			UMyDefaultAttributesEffect::StaticClass(),
+			Config.DefaultAbilityLevel,
+			AbilitySystemComponent->MakeEffectContext());
+	if(!SpecHandle.IsValid())
+	{
+		return;
+	}
+
+	FGameplayEffectSpec &Spec = *SpecHandle.Data.Get();
+	Spec.SetSetByCallerMagnitude(DataTags::MaxHealth,
+		OrDefault(Attributes.MaxHealth, Config.DefaultMaxHealth));
+	Spec.SetSetByCallerMagnitude(
+		DataTags::Health, OrDefault(Attributes.Health, Config.DefaultHealth));
+	Spec.SetSetByCallerMagnitude(DataTags::MaxStamina,
+		OrDefault(Attributes.MaxStamina, Config.DefaultMaxStamina));
+	Spec.SetSetByCallerMagnitude(DataTags::Stamina,
+		OrDefault(Attributes.Stamina, Config.DefaultStamina));
+	Spec.SetSetByCallerMagnitude(DataTags::MaxWalkSpeed,
+		OrDefault(Attributes.MaxWalkSpeed, Config.DefaultMaxWalkSpeed));
+	AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(Spec);
+}
+
+void UMyAttributeComponent::ResetAbilitySystem()
 {
 	if(!IsAbilitySystemValid() || !AttributeSet)
 	{
 		return;
 	}
 
-	// Bind to health change delegate on the owner character
-	if(AMyBaseCharacter *Character = Cast<AMyBaseCharacter>(GetOwner()))
+	AbilitySystemComponent->CancelAllAbilities();
+
+	// An empty query matches every active effect
+	AbilitySystemComponent->RemoveActiveEffects(FGameplayEffectQuery());
+
+	// Effect tags went with the effects; what remains is loose
+	FGameplayTagContainer OwnedTags;
+	AbilitySystemComponent->GetOwnedGameplayTags(OwnedTags);
+	for(const FGameplayTag &Tag : OwnedTags)
 	{
-		GetOnHealthChanged().AddUObject(
-			Character, &AMyBaseCharacter::OnHealthChanged);
+		AbilitySystemComponent->SetLooseGameplayTagCount(Tag, 0);
 	}
 
-	// Always apply component properties to override attributes
-	AbilitySystemComponent->ApplyModToAttribute(
-		AttributeSet->GetHealthAttribute(), EGameplayModOp::Override,
-		Health > 0.0f ? Health : FGameConfig::GetDefault().DefaultHealth);
-	AbilitySystemComponent->ApplyModToAttribute(
-		AttributeSet->GetMaxHealthAttribute(), EGameplayModOp::Override,
-		MaxHealth > 0.0f ? MaxHealth
-						 : FGameConfig::GetDefault().DefaultMaxHealth);
-	AbilitySystemComponent->ApplyModToAttribute(
-		AttributeSet->GetStaminaAttribute(), EGameplayModOp::Override,
-		Stamina > 0.0f ? Stamina : FGameConfig::GetDefault().DefaultStamina);
-	AbilitySystemComponent->ApplyModToAttribute(
-		AttributeSet->GetMaxStaminaAttribute(), EGameplayModOp::Override,
-		MaxStamina > 0.0f ? MaxStamina
-						  : FGameConfig::GetDefault().DefaultMaxStamina);
-	AbilitySystemComponent->ApplyModToAttribute(
-		AttributeSet->GetMaxWalkSpeedAttribute(), EGameplayModOp::Override,
-		MaxWalkSpeed > 0.0f ? MaxWalkSpeed
-							: FGameConfig::GetDefault().DefaultMaxWalkSpeed);
+	AbilitySystemComponent->ClearDamageSpecCache();
+	bIsSprinting = false;
+	bIsDodging = false;
+
+	ApplyDefaultAttributeValues();
+	InitializeAttributes();
+	SetInitialCharacterMovement();
 }
 
 FDefaultAttributes UMyAttributeComponent::GetDefaultAttributes() const
@@ -411,7 +436,7 @@ void UMyAttributeComponent::OnStaminaChange(const FOnAttributeChangeData &Data)
 	if(Data.NewValue <= 0.0f && AbilitySystemComponent
 		&& AbilitySystemComponent->AbilityActorInfo.IsValid()
 		&& AbilitySystemComponent->HasMatchingGameplayTag(
-			FGameplayTag::RequestGameplayTag(StateTags::Sprinting)))
+			StateTags::Sprinting))
 	{
 		// Out of stamina - stop sprinting
 		SetSprinting(false);
@@ -423,7 +448,7 @@ void UMyAttributeComponent::OnStaminaChange(const FOnAttributeChangeData &Data)
 void UMyAttributeComponent::HandleDeath()
 {
 	AActor *Owner = GetOwner();
-	if(Owner)
+	if(Owner && bDestroyOwnerOnDeath)
 	{
 		// Default: destroy actor after a delay
 		Owner->SetLifeSpan(FGameConfig::GetDefault().DeathLifeSpan);
@@ -439,29 +464,7 @@ void UMyAttributeComponent::SetDefaultAttributes(
 	}
 
 	// Always set attributes to the provided values
-	AbilitySystemComponent->ApplyModToAttribute(
-		AttributeSet->GetHealthAttribute(), EGameplayModOp::Override,
-		Attributes.Health > 0.0f ? Attributes.Health
-								 : FGameConfig::GetDefault().DefaultHealth);
-	AbilitySystemComponent->ApplyModToAttribute(
-		AttributeSet->GetMaxHealthAttribute(), EGameplayModOp::Override,
-		Attributes.MaxHealth > 0.0f
-			? Attributes.MaxHealth
-			: FGameConfig::GetDefault().DefaultMaxHealth);
-	AbilitySystemComponent->ApplyModToAttribute(
-		AttributeSet->GetStaminaAttribute(), EGameplayModOp::Override,
-		Attributes.Stamina > 0.0f ? Attributes.Stamina
-								  : FGameConfig::GetDefault().DefaultStamina);
-	AbilitySystemComponent->ApplyModToAttribute(
-		AttributeSet->GetMaxStaminaAttribute(), EGameplayModOp::Override,
-		Attributes.MaxStamina > 0.0f
-			? Attributes.MaxStamina
-			: FGameConfig::GetDefault().DefaultMaxStamina);
-	AbilitySystemComponent->ApplyModToAttribute(
-		AttributeSet->GetMaxWalkSpeedAttribute(), EGameplayModOp::Override,
-		Attributes.MaxWalkSpeed > 0.0f
-			? Attributes.MaxWalkSpeed
-			: FGameConfig::GetDefault().DefaultMaxWalkSpeed);
+	ApplyAttributeValues(Attributes);
 }
 
 bool UMyAttributeComponent::IsAttributeInitialized(
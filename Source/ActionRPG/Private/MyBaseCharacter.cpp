@@ -2,13 +2,22 @@
 
 #include "MyBaseCharacter.h"
 
+#include "MyAttackAbility.h"
 #include "MyAttributeComponent.h"
+#include "MyCombatResolutionSubsystem.h"
+#include "MyHitHistorySubsystem.h"
+#include "MyHurtboxComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 
 AMyBaseCharacter::AMyBaseCharacter()
 {
 	PrimaryActorTick.bCanEverTick = true;
 
+	// Hurtbox for combat queries; subclasses pick the team profile
+	HurtboxComponent =
+		CreateDefaultSubobject<UMyHurtboxComponent>(ComponentNames::Hurtbox);
+	HurtboxComponent->SetupAttachment(GetCapsuleComponent());
+
 	// AttributeComponent will be created dynamically in BeginPlay to allow
 	// Blueprint subclasses
 }
@@ -25,6 +34,7 @@ void AMyBaseCharacter::BeginPlay()
 		{
 			ComponentClass = UMyAttributeComponent::StaticClass();
 		}
+		// Registering initializes the ability system
 		AttributeComponent =
 			NewObject<UMyAttributeComponent>(this, ComponentClass);
 		if(AttributeComponent)
@@ -33,11 +43,29 @@ void AMyBaseCharacter::BeginPlay()
 		}
 	}
 
-	// Initialize attribute component
-	if(AttributeComponent)
+	// Record pose history for lag-compensated hits (server only)
+	if(HasAuthority())
+	{
+		if(UMyHitHistorySubsystem *HitHistory =
+				GetWorld()->GetSubsystem<UMyHitHistorySubsystem>())
+		{
+			HitHistory->RegisterCharacter(this);
+		}
+	}
+}
+
+void AMyBaseCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if(UWorld *World = GetWorld())
 	{
-		AttributeComponent->InitializeAttributeComponent();
+		if(UMyHitHistorySubsystem *HitHistory =
+				World->GetSubsystem<UMyHitHistorySubsystem>())
+		{
+			HitHistory->UnregisterCharacter(this);
+		}
 	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AMyBaseCharacter::Tick(float DeltaTime)
@@ -45,6 +73,52 @@ void AMyBaseCharacter::Tick(float DeltaTime)
 	Super::Tick(DeltaTime);
 }
 
+void AMyBaseCharacter::PossessedBy(AController *NewController)
+{
+	Super::PossessedBy(NewController);
+
+	if(AttributeComponent)
+	{
+		AttributeComponent->RefreshAbilityActorInfo();
+	}
+}
+
+void AMyBaseCharacter::OnRep_PlayerState()
+{
+	Super::OnRep_PlayerState();
+
+	if(AttributeComponent)
+	{
+		AttributeComponent->RefreshAbilityActorInfo();
+	}
+}
+
+void AMyBaseCharacter::GetAttackMontages(
+	TArray<UAnimMontage *> &OutMontages) const
+{
+	// Combo montages of granted attack abilities
+	const UClass *ComponentClass = AttributeComponentClass.Get();
+	const UMyAttributeComponent *ComponentDefaults =
+		ComponentClass
+			? ComponentClass->GetDefaultObject<UMyAttributeComponent>()
+			: nullptr;
+	if(!ComponentDefaults)
+	{
+		return;
+	}
+
+	for(const TSubclassOf<UMyGameplayAbility> &AbilityClass :
+		ComponentDefaults->GetDefaultAbilityClasses())
+	{
+		const UMyAttackAbility *AttackAbility =
+			Cast<UMyAttackAbility>(AbilityClass.GetDefaultObject());
+		if(AttackAbility)
+		{
+			OutMontages.Append(AttackAbility->GetAttackMontages());
+		}
+	}
+}
+
 void AMyBaseCharacter::HandleDeath()
 {
 	// Base implementation - disable movement and set death status
@@ -55,6 +129,11 @@ void AMyBaseCharacter::HandleDeath()
 
 	bIsDead = true;
 
+	if(HurtboxComponent)
+	{
+		HurtboxComponent->DisableHurtbox();
+	}
+
 	// Play death animation if available
 	if(DeathMontage)
 	{
@@ -83,18 +162,69 @@ float AMyBaseCharacter::TakeDamage(float DamageAmount,
 	float ActualDamage = Super::TakeDamage(
 		DamageAmount, DamageEvent, EventInstigator, DamageCauser);
 
-	// Apply damage through GAS attributes
-	if(AttributeComponent && AttributeComponent->IsAbilitySystemValid())
+	// Merge with other damage this frame when the subsystem is available
+	UMyCombatResolutionSubsystem *CombatResolution =
+		GetWorld() ? GetWorld()->GetSubsystem<UMyCombatResolutionSubsystem>()
+				   : nullptr;
+	if(CombatResolution)
 	{
-		// Apply damage to health attribute
-		AttributeComponent->GetAbilitySystemComponent()->ApplyModToAttribute(
-			AttributeComponent->GetAttributeSet()->GetHealthAttribute(),
-			EGameplayModOp::Additive, -ActualDamage);
+		FMyDamageEvent ResolvedEvent;
+		ResolvedEvent.Target = this;
+		ResolvedEvent.DamageCauser = DamageCauser;
+		ResolvedEvent.DamageAmount = ActualDamage;
+		CombatResolution->QueueDamage(ResolvedEvent);
+	}
+	else
+	{
+		ApplyResolvedDamage(ActualDamage, DamageCauser);
 	}
 
 	return ActualDamage;
 }
 
+void AMyBaseCharacter::ApplyResolvedDamage(float DamageAmount,
+	AActor *DamageCauser, TSubclassOf<UGameplayEffect> DamageEffectClass)
+{
+	if(ApplyDamageAttribute(DamageAmount, DamageCauser, DamageEffectClass))
+	{
+		OnDamageResolved(DamageAmount, DamageCauser);
+	}
+}
+
+bool AMyBaseCharacter::ApplyDamageAttribute(float DamageAmount,
+	AActor *DamageCauser, TSubclassOf<UGameplayEffect> DamageEffectClass)
+{
+	if(!IsAttributeSystemValid())
+	{
+		return false;
+	}
+
+	UMyAbilitySystemComponent *TargetASC = GetMyAbilitySystem();
+	if(DamageEffectClass)
+	{
+		// Use the attacker's cached spec; fall back to our own cache when the
+		// attacker has no ability system yet
+		UMyAbilitySystemComponent *SourceASC = TargetASC;
+		AMyBaseCharacter *Attacker = Cast<AMyBaseCharacter>(DamageCauser);
+		if(Attacker && Attacker->IsAbilitySystemReady())
+		{
+			SourceASC = Attacker->GetMyAbilitySystem();
+		}
+
+		SourceASC->ApplyCachedDamageSpec(DamageEffectClass,
+			FGameConfig::GetDefault().DefaultAbilityLevel, DamageAmount,
+			TargetASC);
+	}
+	else
+	{
+		// Apply damage to health attribute
+		TargetASC->ApplyModToAttribute(
+			AttributeComponent->GetAttributeSet()->GetHealthAttribute(),
+			EGameplayModOp::Additive, -DamageAmount);
+	}
+	return true;
+}
+
 void AMyBaseCharacter::OnHealthChanged(float NewHealth)
 {
 	// Base implementation - can be overridden by subclasses
@@ -0,0 +1,22 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyBlackboardKeys.h"
+
+#include "BehaviorTree/BlackboardData.h"
+
+TArray<FName> FMyEnemyBlackboardKeys::Resolve(const UBlackboardData &Asset)
+{
+	TArray<FName> MissingKeys;
+	auto ResolveKey = [&Asset, &MissingKeys](const FName &KeyName) {
+		const FBlackboard::FKey KeyID = Asset.GetKeyID(KeyName);
+		if(KeyID == FBlackboard::InvalidKey)
+		{
+			MissingKeys.Add(KeyName);
+		}
+		return KeyID;
+	};
+
+	AttackRange = ResolveKey(BlackboardKeyNames::AttackRange);
+	PatrolLocation = ResolveKey(BlackboardKeyNames::PatrolLocation);
+	return MissingKeys;
+}
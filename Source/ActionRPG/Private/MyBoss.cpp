@@ -1,10 +1,13 @@
 // Copyright 2025 ngmitam. All Rights Reserved.
 
 #include "MyBoss.h"
+#include "MyAbilitySystemComponent.h"
 #include "MyAttributeComponent.h"
 #include "MyCharacter.h"
 #include "MyDamageEffect.h"
+#include "MyMontageTimelineSubsystem.h"
 #include "Components/StaticMeshComponent.h"
+#include "Engine/AssetManager.h"
 #include "Engine/EngineTypes.h"
 #include "Engine/OverlapResult.h"
 #include "GameFramework/Character.h"
@@ -22,6 +25,9 @@ AMyBoss::AMyBoss()
 
 	// Boss attacks from farther distance due to spear
 	AttackRange = 200.0f; // Increased from Enemy's 150.0f
+
+	// The boss is placed once per area and never respawned
+	bReturnToPoolOnDeath = false;
 }
 
 void AMyBoss::BeginPlay()
@@ -29,11 +35,6 @@ void AMyBoss::BeginPlay()
 	Super::BeginPlay();
 }
 
-void AMyBoss::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-}
-
 void AMyBoss::AttackPlayer(ACharacter *Player)
 {
 	if(!Player)
@@ -71,6 +72,8 @@ void AMyBoss::ResetAttackState()
 
 	// Clear the fallback timer
 	GetWorld()->GetTimerManager().ClearTimer(AttackResetTimerHandle);
+
+	OnAttackFinished.Broadcast();
 }
 
 void AMyBoss::OnComboInterrupted()
@@ -94,54 +97,42 @@ void AMyBoss::OnComboInterrupted()
 		// Reset attack state since combo is interrupted
 		ResetAttackState();
 
-		SetStunned(true);
-
 		// Reset after stun duration
-		FTimerHandle StunTimer;
-		GetWorld()->GetTimerManager().SetTimer(
-			StunTimer, [this]() { SetStunned(false); }, StunDuration, false);
+		StunFor(StunDuration);
 	}
 }
 
-float AMyBoss::TakeDamage(float DamageAmount,
-	struct FDamageEvent const &DamageEvent, class AController *EventInstigator,
-	AActor *DamageCauser)
+void AMyBoss::OnDamageResolved(float DamageAmount, AActor *DamageCauser)
 {
-	float ActualDamage = Super::TakeDamage(
-		DamageAmount, DamageEvent, EventInstigator, DamageCauser);
-
-	// Update health bar after damage is applied through GAS
-	UpdateHealthBar();
+	// Health bar was already refreshed by OnEnemyHealthChanged
 
 	// Check if dead using GAS health
 	if(AttributeComponent && AttributeComponent->GetHealth() <= 0.0f)
 	{
-		// Death clears stun
-		SetStunned(false);
-		HandleDeath();
+		if(!bIsDead)
+		{
+			HandleDeath();
+		}
 	}
 	else
 	{
 		// Stun only if in combo
 		if(bIsInCombo)
 		{
-			SetStunned(true);
-			// Interrupt combo
+			// Interrupt combo (stuns and resets bIsInCombo)
 			OnComboInterrupted();
-			// reset bIsInCombo to false
-			bIsInCombo = false;
 		}
 		else
 		{
 			SetStunned(false);
 		}
 	}
-
-	return ActualDamage;
 }
 
 void AMyBoss::OnAttackMontageEnded(UAnimMontage *Montage, bool bInterrupted)
 {
+	StopTimelineMontage(Montage);
+
 	if(bInterrupted)
 	{
 		OnComboInterrupted();
@@ -172,26 +163,40 @@ EBossAttackType AMyBoss::SelectRandomAttack()
 
 bool AMyBoss::PlayAttack(EBossAttackType AttackType)
 {
-	UAnimMontage *MontageToPlay = nullptr;
+	// Hold the attack until the pre-warm has streamed the montages in,
+	// rather than loading them on the game thread; the attack task tries
+	// again on its next run
+	if(!AreAssetsLoaded())
+	{
+		PrewarmAssets();
+		return false;
+	}
 
+	UAnimMontage *MontageToPlay = nullptr;
 	switch(AttackType)
 	{
 	case EBossAttackType::Attack1:
-		MontageToPlay = Attack1Montage;
+		MontageToPlay = Attack1Montage.Get();
 		bIsInCombo = false;
 		break;
 	case EBossAttackType::Attack2:
-		MontageToPlay = Attack2Montage;
+		MontageToPlay = Attack2Montage.Get();
 		bIsInCombo = false;
 		break;
 	case EBossAttackType::Combo:
-		MontageToPlay = ComboMontage;
+		MontageToPlay = ComboMontage.Get();
 		bIsInCombo = true;
 		break;
 	}
 
 	if(MontageToPlay)
 	{
+		// Boss attacks don't activate abilities, so refresh hits here
+		if(UMyAbilitySystemComponent *ASC = GetMyAbilitySystem())
+		{
+			ASC->RefreshDamageSpecs();
+		}
+
 		USkeletalMeshComponent *SkeletalMesh = GetMesh();
 		if(SkeletalMesh)
 		{
@@ -201,9 +206,17 @@ bool AMyBoss::PlayAttack(EBossAttackType AttackType)
 				AnimInstance->Montage_Stop(0.0f);
 				AnimInstance->OnMontageEnded.RemoveDynamic(
 					this, &AMyBoss::OnAttackMontageEnded);
-				AnimInstance->Montage_Play(MontageToPlay);
+				const float PlayRate = 1.0f;
+				AnimInstance->Montage_Play(MontageToPlay, PlayRate);
 				AnimInstance->OnMontageEnded.AddDynamic(
 					this, &AMyBoss::OnAttackMontageEnded);
+
+				// Fire its notifies without pose evaluation on servers
+				if(UMyMontageTimelineSubsystem *Timeline =
+						GetWorld()->GetSubsystem<UMyMontageTimelineSubsystem>())
+				{
+					Timeline->StartMontage(this, MontageToPlay, PlayRate);
+				}
 				return true;
 			}
 		}
@@ -211,6 +224,75 @@ bool AMyBoss::PlayAttack(EBossAttackType AttackType)
 	return false;
 }
 
+void AMyBoss::GetAttackMontages(TArray<UAnimMontage *> &OutMontages) const
+{
+	Super::GetAttackMontages(OutMontages);
+
+	for(const TSoftObjectPtr<UAnimMontage> *Montage :
+		{&Attack1Montage, &Attack2Montage, &ComboMontage})
+	{
+		if(UAnimMontage *LoadedMontage = Montage->LoadSynchronous())
+		{
+			OutMontages.AddUnique(LoadedMontage);
+		}
+	}
+}
+
+void AMyBoss::PrewarmAssets()
+{
+	if(AssetsHandle.IsValid())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> AssetPaths;
+	for(const FSoftObjectPath &Path :
+		{Attack1Montage.ToSoftObjectPath(), Attack2Montage.ToSoftObjectPath(),
+			ComboMontage.ToSoftObjectPath(), SpearMeshAsset.ToSoftObjectPath()})
+	{
+		if(!Path.IsNull())
+		{
+			AssetPaths.Add(Path);
+		}
+	}
+
+	if(AssetPaths.Num() == 0)
+	{
+		return;
+	}
+
+	AssetsHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		AssetPaths, FStreamableDelegate::CreateUObject(
+						this, &AMyBoss::OnAssetsLoaded));
+}
+
+bool AMyBoss::AreAssetsLoaded() const
+{
+	if(AssetsHandle.IsValid() && AssetsHandle->HasLoadCompleted())
+	{
+		return true;
+	}
+
+	// Not streamed by us, but maybe referenced elsewhere or unset
+	for(const TSoftObjectPtr<UAnimMontage> *Montage :
+		{&Attack1Montage, &Attack2Montage, &ComboMontage})
+	{
+		if(!Montage->IsNull() && !Montage->Get())
+		{
+			return false;
+		}
+	}
+	return SpearMeshAsset.IsNull() || SpearMeshAsset.Get();
+}
+
+void AMyBoss::OnAssetsLoaded()
+{
+	if(SpearMesh && !SpearMeshAsset.IsNull())
+	{
+		SpearMesh->SetStaticMesh(SpearMeshAsset.Get());
+	}
+}
+
 bool AMyBoss::CanBeStunned() const
 {
 	// Boss can be stunned only if not in combo
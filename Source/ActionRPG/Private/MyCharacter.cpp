@@ -10,6 +10,10 @@
 #include "MyAbilityTypes.h"
 #include "MyAttributeComponent.h"
 #include "MyEnemy.h"
+#include "MyEnemyRegistrySubsystem.h"
+#include "MyHurtboxComponent.h"
+#include "MyPerceptionSubsystem.h"
+#include "MyPlayerRegistrySubsystem.h"
 #include "MyPlayerUI.h"
 
 AMyCharacter::AMyCharacter()
@@ -53,6 +57,9 @@ AMyCharacter::AMyCharacter()
 		SpringArmComponent, USpringArmComponent::SocketName);
 	CameraComponent->bUsePawnControlRotation = false;
 
+	HurtboxComponent->SetCollisionProfileName(
+		CollisionProfiles::PlayerHurtbox);
+
 	// Attribute Component will be created in BeginPlay
 }
 void AMyCharacter::PossessedBy(AController *NewController)
@@ -69,8 +76,23 @@ void AMyCharacter::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Make this player visible to AI targeting
+	if(UMyPlayerRegistrySubsystem *PlayerRegistry =
+			GetWorld()->GetSubsystem<UMyPlayerRegistrySubsystem>())
+	{
+		PlayerRegistry->RegisterPlayer(this);
+	}
+
 	InitializePlayerUI();
 
+	// The registry reports enemies entering and leaving detection range
+	if(UMyEnemyRegistrySubsystem *Registry =
+			GetWorld()->GetSubsystem<UMyEnemyRegistrySubsystem>())
+	{
+		EnemyRangeWatch = Registry->AddRangeWatch(
+			FGameConfig::GetDefault().EnemyDetectionRange);
+	}
+
 	// Start updating nearby enemies
 	UpdateNearbyEnemies(); // Initial update
 	GetWorld()->GetTimerManager().SetTimer(UpdateEnemiesTimerHandle, this,
@@ -78,6 +100,24 @@ void AMyCharacter::BeginPlay()
 		FGameConfig::GetDefault().EnemyUpdateInterval, true);
 }
 
+void AMyCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if(UMyPlayerRegistrySubsystem *PlayerRegistry =
+			GetWorld()->GetSubsystem<UMyPlayerRegistrySubsystem>())
+	{
+		PlayerRegistry->UnregisterPlayer(this);
+	}
+
+	if(UMyEnemyRegistrySubsystem *Registry =
+			GetWorld()->GetSubsystem<UMyEnemyRegistrySubsystem>())
+	{
+		Registry->RemoveRangeWatch(EnemyRangeWatch);
+	}
+	EnemyRangeWatch = INDEX_NONE;
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AMyCharacter::InitializePlayerUI()
 {
 	// Create and display the Player Controller
@@ -180,9 +220,7 @@ void AMyCharacter::StopSprint()
 		return;
 	}
 
-	FGameplayTagContainer SprintAbilityTagContainer;
-	SprintAbilityTagContainer.AddTag(
-		FGameplayTag::RequestGameplayTag(AbilityTags::Sprint));
+	FGameplayTagContainer SprintAbilityTagContainer(AbilityTags::Sprint);
 	ASC->CancelAbilities(&SprintAbilityTagContainer);
 	AttributeComponent->SetSprinting(false);
 }
@@ -214,9 +252,7 @@ void AMyCharacter::StopJumping()
 		return;
 	}
 
-	FGameplayTagContainer JumpAbilityTagContainer;
-	JumpAbilityTagContainer.AddTag(
-		FGameplayTag::RequestGameplayTag(AbilityTags::Jump));
+	FGameplayTagContainer JumpAbilityTagContainer(AbilityTags::Jump);
 	ASC->CancelAbilities(&JumpAbilityTagContainer);
 }
 
@@ -246,9 +282,7 @@ void AMyCharacter::ResetDodgeStatus()
 		AttributeComponent->SetDodging(false);
 		if(UAbilitySystemComponent *ASCInner = TryGetAbilitySystem())
 		{
-			FGameplayTagContainer DodgeAbilityTagContainer;
-			DodgeAbilityTagContainer.AddTag(
-				FGameplayTag::RequestGameplayTag(AbilityTags::Dodge));
+			FGameplayTagContainer DodgeAbilityTagContainer(AbilityTags::Dodge);
 			ASCInner->CancelAbilities(&DodgeAbilityTagContainer);
 		}
 	}
@@ -256,13 +290,18 @@ void AMyCharacter::ResetDodgeStatus()
 
 void AMyCharacter::Attack()
 {
-	UAbilitySystemComponent *ASC = TryGetAbilitySystem();
+	if(!IsAbilitySystemReady())
+	{
+		return;
+	}
+
+	UMyAbilitySystemComponent *ASC = GetMyAbilitySystem();
 	if(!ASC)
 	{
 		return;
 	}
 
-	UMyAttackAbility *ActiveAbility = GetActiveAttackAbility();
+	UMyAttackAbility *ActiveAbility = ASC->GetActiveAttackAbility();
 	if(ActiveAbility)
 	{
 		ActiveAbility->OnAttackInputPressed();
@@ -270,17 +309,10 @@ void AMyCharacter::Attack()
 	}
 
 	// Check if attack ability is available
-	TArray<FGameplayAbilitySpec> Abilities = ASC->GetActivatableAbilities();
-	for(const FGameplayAbilitySpec &Spec : Abilities)
+	if(ASC->HasAttackAbility())
 	{
-		if(Spec.Ability
-			&& Spec.Ability->GetClass()->IsChildOf(
-				UMyAttackAbility::StaticClass()))
-		{
-			ASC->AbilityLocalInputPressed(
-				static_cast<int32>(EMyAbilityInputID::Attack));
-			break;
-		}
+		ASC->AbilityLocalInputPressed(
+			static_cast<int32>(EMyAbilityInputID::Attack));
 	}
 }
 
@@ -339,92 +371,139 @@ int32 AMyCharacter::GetCurrentComboIndex() const
 
 UMyAttackAbility *AMyCharacter::GetActiveAttackAbility() const
 {
-	UAbilitySystemComponent *ASC = TryGetAbilitySystem();
-	if(!ASC)
-	{
-		return nullptr;
-	}
-
-	TArray<FGameplayAbilitySpec> Abilities = ASC->GetActivatableAbilities();
-
-	for(const FGameplayAbilitySpec &Spec : Abilities)
-	{
-		if(Spec.Ability
-			&& Spec.Ability->GetClass()->IsChildOf(
-				UMyAttackAbility::StaticClass()))
-		{
-			if(Spec.IsActive())
-			{
-				return Cast<UMyAttackAbility>(Spec.GetPrimaryInstance());
-			}
-		}
-	}
-
-	return nullptr;
+	UMyAbilitySystemComponent *ASC = GetMyAbilitySystem();
+	return ASC ? ASC->GetActiveAttackAbility() : nullptr;
 }
 
 void AMyCharacter::UpdateNearbyEnemies()
 {
-	PreviousNearbyEnemies = NearbyEnemies;
-	NearbyEnemies.Empty();
-
-	FindNearbyEnemies();
-	SortEnemiesByDistance();
+	DiffNearbyEnemies();
 	UpdateHealthBarVisibility();
 	ValidateCurrentTarget();
 }
 
-void AMyCharacter::FindNearbyEnemies()
+void AMyCharacter::DiffNearbyEnemies()
 {
-	TArray<AActor *> AllEnemies;
-	UGameplayStatics::GetAllActorsOfClass(
-		GetWorld(), AMyEnemy::StaticClass(), AllEnemies);
+	EnteredEnemies.Reset();
+	ExitedEnemies.Reset();
 
-	const float DetectionRange = FGameConfig::GetDefault().EnemyDetectionRange;
-	const FVector PlayerLocation = GetActorLocation();
+	UMyEnemyRegistrySubsystem *Registry =
+		GetWorld()->GetSubsystem<UMyEnemyRegistrySubsystem>();
+	if(!Registry)
+	{
+		return;
+	}
 
-	for(AActor *Actor : AllEnemies)
+	// Bosses only become targets once their area is activated
+	for(int32 Index = InactiveNearbyEnemies.Num() - 1; Index >= 0; --Index)
 	{
-		if(AMyEnemy *Enemy = Cast<AMyEnemy>(Actor))
+		AMyEnemy *Enemy = InactiveNearbyEnemies[Index].Get();
+		if(Enemy && !Enemy->IsActivated())
 		{
-			const float Distance =
-				FVector::Dist(PlayerLocation, Enemy->GetActorLocation());
-			if(Distance <= DetectionRange && Enemy->IsActivated())
-			{
-				NearbyEnemies.Add(Enemy);
-			}
+			continue;
+		}
+
+		if(Enemy)
+		{
+			NearbyEnemies.Add(Enemy);
+			EnteredEnemies.Add(Enemy);
+		}
+		InactiveNearbyEnemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	}
+
+	// Only the enemies that crossed the range since the last update come
+	// back, so this costs the number of changes, not of enemies in range
+	const int32 FirstEntered = EnteredEnemies.Num();
+	Registry->UpdateRangeWatch(
+		EnemyRangeWatch, GetActorLocation(), EnteredEnemies, ExitedEnemies);
+
+	for(int32 Index = EnteredEnemies.Num() - 1; Index >= FirstEntered;
+		--Index)
+	{
+		AMyEnemy *Enemy = EnteredEnemies[Index];
+		if(Enemy->IsActivated())
+		{
+			NearbyEnemies.Add(Enemy);
+		}
+		else
+		{
+			InactiveNearbyEnemies.Add(Enemy);
+			EnteredEnemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		}
+	}
+
+	// Enemies that left without ever being activated had no health bar
+	for(int32 Index = ExitedEnemies.Num() - 1; Index >= 0; --Index)
+	{
+		if(NearbyEnemies.Remove(ExitedEnemies[Index]) == 0)
+		{
+			InactiveNearbyEnemies.RemoveSwap(
+				ExitedEnemies[Index], EAllowShrinking::No);
+			ExitedEnemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
 		}
 	}
 }
 
-void AMyCharacter::SortEnemiesByDistance()
+void AMyCharacter::SelectTargetCandidates()
 {
-	const FVector PlayerLocation = GetActorLocation();
+	const FGameConfig &Config = FGameConfig::GetDefault();
+	const UMyPerceptionSubsystem *Perception =
+		GetWorld()->GetSubsystem<UMyPerceptionSubsystem>();
 
-	NearbyEnemies.Sort(
-		[PlayerLocation](const AMyEnemy &A, const AMyEnemy &B)
+	EnemiesInRange.Reset();
+	for(const TWeakObjectPtr<AMyEnemy> &Nearby : NearbyEnemies)
+	{
+		AMyEnemy *Enemy = Nearby.Get();
+		if(Enemy && !Enemy->bIsDead)
 		{
-			const float DistA =
-				FVector::DistSquared(PlayerLocation, A.GetActorLocation());
-			const float DistB =
-				FVector::DistSquared(PlayerLocation, B.GetActorLocation());
-			return DistA < DistB;
-		});
+			EnemiesInRange.Add(Enemy);
+		}
+	}
+
+	TargetScorer.Reset(GetActorLocation());
+	for(AMyEnemy *Enemy : EnemiesInRange)
+	{
+		// Enemies that can't see us are taken as hidden from us too
+		const bool bOccluded =
+			Perception && Perception->IsOccludedFrom(Enemy, this);
+		TargetScorer.Add(
+			Enemy->GetActorLocation(), bOccluded, Enemy->GetTargetThreat());
+	}
+
+	FMyTargetScoreWeights Weights;
+	Weights.Distance = Config.TargetScoreDistanceWeight;
+	Weights.Facing = Config.TargetScoreFacingWeight;
+	Weights.Visibility = Config.TargetScoreVisibilityWeight;
+	Weights.Threat = Config.TargetScoreThreatWeight;
+
+	const FVector Forward = CameraComponent
+								? CameraComponent->GetForwardVector()
+								: GetControlRotation().Vector();
+	TargetScorer.Score(Forward, Config.EnemyDetectionRange, Weights);
+	TargetScorer.SelectBest(Config.TargetCandidateCount, BestCandidateIndices);
+
+	// Scorer indices follow EnemiesInRange
+	TargetCandidates.Reset();
+	for(const int32 Index : BestCandidateIndices)
+	{
+		TargetCandidates.Add(EnemiesInRange[Index]);
+	}
 }
 
 void AMyCharacter::UpdateHealthBarVisibility()
 {
 	// Hide health bars for enemies that are no longer nearby
-	for(AMyEnemy *Enemy : PreviousNearbyEnemies)
+	for(const TWeakObjectPtr<AMyEnemy> &Exited : ExitedEnemies)
 	{
-		if(!NearbyEnemies.Contains(Enemy) && Enemy != CurrentTarget)
+		AMyEnemy *Enemy = Exited.Get();
+		if(Enemy && Enemy != CurrentTarget)
 		{
 			Enemy->SetHealthBarVisible(false);
 		}
 	}
 
-	// Show health bars for nearby enemies
-	for(AMyEnemy *Enemy : NearbyEnemies)
+	// Show health bars for enemies that just came into range
+	for(AMyEnemy *Enemy : EnteredEnemies)
 	{
 		if(Enemy != CurrentTarget)
 		{
@@ -440,12 +519,28 @@ void AMyCharacter::ValidateCurrentTarget()
 	{
 		ClearTarget();
 
-		// Focus new nearest enemy if available
-		if(NearbyEnemies.Num() > 0)
+		// Focus the best scored enemy if available
+		SelectTargetCandidates();
+		SetTarget(GetBestTargetCandidate());
+	}
+}
+
+AMyEnemy *AMyCharacter::GetBestTargetCandidate() const
+{
+	for(const TWeakObjectPtr<AMyEnemy> &Candidate : TargetCandidates)
+	{
+		AMyEnemy *Enemy = Candidate.Get();
+		if(Enemy && !Enemy->bIsDead)
 		{
-			SetTarget(NearbyEnemies[0]);
+			return Enemy;
 		}
 	}
+	return nullptr;
+}
+
+bool AMyCharacter::IsEnemyInFocusRange(AMyEnemy *Enemy) const
+{
+	return NearbyEnemies.Contains(Enemy);
 }
 
 void AMyCharacter::SetTarget(AMyEnemy *NewTarget)
@@ -499,34 +594,60 @@ void AMyCharacter::FocusEnemy()
 	}
 	else
 	{
-		// Focus nearest enemy
-		if(NearbyEnemies.Num() > 0)
-		{
-			SetTarget(NearbyEnemies[0]);
-		}
+		// Score with the camera as it is now, not as of the last update
+		UpdateNearbyEnemies();
+		SelectTargetCandidates();
+		SetTarget(GetBestTargetCandidate());
 	}
 }
 
 void AMyCharacter::CycleTarget()
 {
-	// If no nearby enemies, clear target
-	if(NearbyEnemies.Num() == 0)
+	UpdateNearbyEnemies();
+	SelectTargetCandidates();
+
+	if(!CurrentTarget)
 	{
-		ClearTarget();
+		SetTarget(GetBestTargetCandidate());
 		return;
 	}
 
-	// Find current target index in nearby enemies
-	int32 CurrentIndex = NearbyEnemies.Find(CurrentTarget);
-	if(CurrentIndex == INDEX_NONE)
+	// Walk the candidates clockwise around the player, starting from the
+	// current target. Score order can't be used here: the camera tracks
+	// the locked target, so it always scores best and cycling would only
+	// ever alternate between the top two candidates.
+	const FVector Location = GetActorLocation();
+	const float CurrentYaw =
+		(CurrentTarget->GetActorLocation() - Location).Rotation().Yaw;
+
+	AMyEnemy *NewTarget = nullptr;
+	float BestDelta = TNumericLimits<float>::Max();
+	for(const TWeakObjectPtr<AMyEnemy> &Candidate : TargetCandidates)
 	{
-		// Current target not in nearby enemies, start with first enemy
-		CurrentIndex = 0;
-	}
+		AMyEnemy *Enemy = Candidate.Get();
+		if(!Enemy || Enemy->bIsDead || Enemy == CurrentTarget)
+		{
+			continue;
+		}
 
-	// Cycle to next enemy
-	const int32 NextIndex = (CurrentIndex + 1) % NearbyEnemies.Num();
-	AMyEnemy *NewTarget = NearbyEnemies[NextIndex];
+		const float Yaw = (Enemy->GetActorLocation() - Location).Rotation().Yaw;
+		float Delta = FRotator::ClampAxis(Yaw - CurrentYaw);
+		if(Delta < KINDA_SMALL_NUMBER)
+		{
+			// Directly behind the current target: visit it last, so two
+			// enemies in line don't cycle between each other
+			Delta = 360.0f;
+		}
+		if(Delta < BestDelta)
+		{
+			BestDelta = Delta;
+			NewTarget = Enemy;
+		}
+	}
 
-	SetTarget(NewTarget);
+	// Keep the current target if it is the only candidate left
+	if(NewTarget)
+	{
+		SetTarget(NewTarget);
+	}
 }
@@ -0,0 +1,132 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyCombatResolutionSubsystem.h"
+
+#include "ActionRPG.h"
+#include "MyBaseCharacter.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Events / Frame"),
+	STAT_DamageEventsPerFrame, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Targets / Frame"),
+	STAT_DamageTargetsPerFrame, STATGROUP_ActionRPG);
+DECLARE_CYCLE_STAT(TEXT("Resolve Combat Damage"), STAT_ResolveCombatDamage,
+	STATGROUP_ActionRPG);
+
+void UMyCombatResolutionSubsystem::QueueDamage(
+	const FMyDamageEvent &DamageEvent)
+{
+	if(!DamageEvent.Target.IsValid() || DamageEvent.DamageAmount <= 0.0f)
+	{
+		return;
+	}
+
+	++EventsQueuedThisFrame;
+
+	// Merge with earlier damage to the same target this frame
+	int32 &Index =
+		PendingTargetIndices.FindOrAdd(DamageEvent.Target, INDEX_NONE);
+	if(Index == INDEX_NONE)
+	{
+		Index = PendingTargets.Num();
+		PendingTargets.AddDefaulted_GetRef().Target = DamageEvent.Target;
+	}
+
+	FPendingTargetDamage &Pending = PendingTargets[Index];
+	Pending.TotalDamage += DamageEvent.DamageAmount;
+
+	// Hits from the same causer and effect share one attribute change
+	for(FDamageContribution &Contribution : Pending.Contributions)
+	{
+		if(Contribution.DamageCauser == DamageEvent.DamageCauser
+			&& Contribution.DamageEffectClass == DamageEvent.DamageEffectClass)
+		{
+			Contribution.Damage += DamageEvent.DamageAmount;
+			return;
+		}
+	}
+
+	FDamageContribution &Contribution =
+		Pending.Contributions.AddDefaulted_GetRef();
+	Contribution.DamageCauser = DamageEvent.DamageCauser;
+	Contribution.DamageEffectClass = DamageEvent.DamageEffectClass;
+	Contribution.Damage = DamageEvent.DamageAmount;
+}
+
+void UMyCombatResolutionSubsystem::FlushPendingDamage()
+{
+	if(bIsResolving || PendingTargets.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_ResolveCombatDamage);
+	TGuardValue<bool> ResolvingGuard(bIsResolving, true);
+
+	// Damage raised while resolving is queued for the next flush
+	Swap(PendingTargets, ResolvingTargets);
+	PendingTargetIndices.Reset();
+
+	for(const FPendingTargetDamage &Pending : ResolvingTargets)
+	{
+		ResolveTarget(Pending);
+	}
+
+	TargetsResolvedThisFrame += ResolvingTargets.Num();
+	ResolvingTargets.Reset();
+}
+
+void UMyCombatResolutionSubsystem::ResolveTarget(
+	const FPendingTargetDamage &Pending) const
+{
+	AMyBaseCharacter *Target = Pending.Target.Get();
+	if(!Target || Target->bIsDead)
+	{
+		return;
+	}
+
+	// Each causer applies its own share; stun and death run once for all
+	AActor *MainCauser = nullptr;
+	float MainDamage = 0.0f;
+	bool bApplied = false;
+	for(const FDamageContribution &Contribution : Pending.Contributions)
+	{
+		AActor *DamageCauser = Contribution.DamageCauser.Get();
+		bApplied |= Target->ApplyDamageAttribute(Contribution.Damage,
+			DamageCauser, Contribution.DamageEffectClass);
+		if(Contribution.Damage > MainDamage)
+		{
+			MainDamage = Contribution.Damage;
+			MainCauser = DamageCauser;
+		}
+	}
+
+	// Reactions see the causer that dealt the most damage
+	if(bApplied)
+	{
+		Target->NotifyDamageResolved(Pending.TotalDamage, MainCauser);
+	}
+}
+
+void UMyCombatResolutionSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	FlushPendingDamage();
+
+	SET_DWORD_STAT(STAT_DamageEventsPerFrame, EventsQueuedThisFrame);
+	SET_DWORD_STAT(STAT_DamageTargetsPerFrame, TargetsResolvedThisFrame);
+	EventsQueuedThisFrame = 0;
+	TargetsResolvedThisFrame = 0;
+}
+
+TStatId UMyCombatResolutionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(
+		UMyCombatResolutionSubsystem, STATGROUP_Tickables);
+}
+
+bool UMyCombatResolutionSubsystem::DoesSupportWorldType(
+	const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
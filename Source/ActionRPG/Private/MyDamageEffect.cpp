@@ -17,8 +17,7 @@ UMyDamageEffect::UMyDamageEffect()
 	ModifierInfo.ModifierOp = EGameplayModOp::Additive;
 	// Use SetByCaller magnitude for dynamic damage (negative to subtract)
 	FSetByCallerFloat SetByCallerFloat;
-	SetByCallerFloat.DataTag =
-		FGameplayTag::RequestGameplayTag(FName("Data.Damage"));
+	SetByCallerFloat.DataTag = DataTags::Damage;
 	ModifierInfo.ModifierMagnitude =
 		FGameplayEffectModifierMagnitude(SetByCallerFloat);
 	Modifiers.Add(ModifierInfo);
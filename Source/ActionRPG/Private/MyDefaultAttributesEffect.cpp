@@ -0,0 +1,32 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyDefaultAttributesEffect.h"
+
+#include "MyAttributeSet.h"
+#include "MyGameplayTags.h"
+
+UMyDefaultAttributesEffect::UMyDefaultAttributesEffect()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	// Maximums first: the attribute set clamps Health and Stamina to them
+	const TPair<FGameplayAttribute, FGameplayTag> AttributeTags[] = {
+		{UMyAttributeSet::GetMaxHealthAttribute(), DataTags::MaxHealth},
+		{UMyAttributeSet::GetHealthAttribute(), DataTags::Health},
+		{UMyAttributeSet::GetMaxStaminaAttribute(), DataTags::MaxStamina},
+		{UMyAttributeSet::GetStaminaAttribute(), DataTags::Stamina},
+		{UMyAttributeSet::GetMaxWalkSpeedAttribute(), DataTags::MaxWalkSpeed},
+	};
+
+	for(const TPair<FGameplayAttribute, FGameplayTag> &Pair : AttributeTags)
+	{
+		FGameplayModifierInfo ModifierInfo;
+		ModifierInfo.Attribute = Pair.Key;
+		ModifierInfo.ModifierOp = EGameplayModOp::Override;
+		FSetByCallerFloat SetByCallerFloat;
+		SetByCallerFloat.DataTag = Pair.Value;
+		ModifierInfo.ModifierMagnitude =
+			FGameplayEffectModifierMagnitude(SetByCallerFloat);
+		Modifiers.Add(ModifierInfo);
+	}
+}
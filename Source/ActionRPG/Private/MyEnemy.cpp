@@ -7,13 +7,23 @@
 #include "Components/ProgressBar.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "MyAbilitySystemComponent.h"
 #include "MyAttributeComponent.h"
 #include "MyCharacter.h"
 #include "MyEnemyAIController.h"
+#include "MyEnemyLODSubsystem.h"
+#include "MyEnemyPoolSubsystem.h"
+#include "MyEnemyRegistrySubsystem.h"
+#include "MyHitHistorySubsystem.h"
+#include "MyHurtboxComponent.h"
+#include "MyMontageTimelineSubsystem.h"
+#include "MyPatrolPathSubsystem.h"
+#include "MyPerceptionSubsystem.h"
 
 AMyEnemy::AMyEnemy()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// Nothing to do per frame; movement, animation and AI tick on their own
+	PrimaryActorTick.bCanEverTick = false;
 
 	// Set AI Controller class
 	AIControllerClass = AMyEnemyAIController::StaticClass();
@@ -37,6 +47,8 @@ AMyEnemy::AMyEnemy()
 		FGameConfig::GetDefault().HealthBarZOffset)); // Above the enemy
 	HealthBarWidget->SetVisibility(false);			  // Hidden by default
 
+	HurtboxComponent->SetCollisionProfileName(CollisionProfiles::EnemyHurtbox);
+
 	// AttributeComponent is now created in base class
 }
 
@@ -59,6 +71,85 @@ void AMyEnemy::BeginPlay()
 
 	// Update health bar with initial values
 	UpdateHealthBar();
+
+	// The server timeline fires attack notifies, so the server only needs
+	// montages ticking, not bone updates
+	UMyMontageTimelineSubsystem *Timeline =
+		GetWorld()->GetSubsystem<UMyMontageTimelineSubsystem>();
+	if(Timeline && Timeline->IsTimelineActive() && GetMesh())
+	{
+		GetMesh()->VisibilityBasedAnimTickOption =
+			EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+	}
+
+	// Death removes the enemy itself (pool or destroy), not a life span
+	if(AttributeComponent)
+	{
+		AttributeComponent->bDestroyOwnerOnDeath = false;
+	}
+
+	RegisterWithWorldSubsystems();
+}
+
+void AMyEnemy::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterFromWorldSubsystems();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AMyEnemy::RegisterWithWorldSubsystems()
+{
+	// Tick rates now follow distance to the players
+	if(UMyEnemyLODSubsystem *LODSubsystem =
+			GetWorld()->GetSubsystem<UMyEnemyLODSubsystem>())
+	{
+		LODSubsystem->RegisterEnemy(this);
+	}
+
+	// Target acquisition finds enemies through the registry
+	if(UMyEnemyRegistrySubsystem *Registry =
+			GetWorld()->GetSubsystem<UMyEnemyRegistrySubsystem>())
+	{
+		Registry->RegisterEnemy(this);
+	}
+
+	// Patrol legs are pathfound ahead of the first patrol move
+	if(UMyPatrolPathSubsystem *PatrolPaths =
+			GetWorld()->GetSubsystem<UMyPatrolPathSubsystem>())
+	{
+		PatrolPaths->RegisterRoute(this, PatrolPoints);
+	}
+
+	// Perception registers the enemy on its first query
+}
+
+void AMyEnemy::UnregisterFromWorldSubsystems()
+{
+	UWorld *World = GetWorld();
+	if(UMyEnemyLODSubsystem *LODSubsystem =
+			World->GetSubsystem<UMyEnemyLODSubsystem>())
+	{
+		LODSubsystem->UnregisterEnemy(this);
+	}
+
+	if(UMyEnemyRegistrySubsystem *Registry =
+			World->GetSubsystem<UMyEnemyRegistrySubsystem>())
+	{
+		Registry->UnregisterEnemy(this);
+	}
+
+	if(UMyPatrolPathSubsystem *PatrolPaths =
+			World->GetSubsystem<UMyPatrolPathSubsystem>())
+	{
+		PatrolPaths->UnregisterRoute(this);
+	}
+
+	if(UMyPerceptionSubsystem *Perception =
+			World->GetSubsystem<UMyPerceptionSubsystem>())
+	{
+		Perception->UnregisterObserver(this);
+	}
 }
 
 void AMyEnemy::InitializeHealthBar()
@@ -71,14 +162,6 @@ void AMyEnemy::InitializeHealthBar()
 	}
 }
 
-void AMyEnemy::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-	// AI logic moved to Behavior Tree for better performance
-	// No longer handling movement and attack in Tick
-}
-
 void AMyEnemy::MoveTowardsPlayer(float DeltaTime)
 {
 	FVector Direction =
@@ -107,6 +190,12 @@ void AMyEnemy::AttackPlayer(ACharacter *Player)
 		LastAttackTime = GetWorld()->GetTimeSeconds();
 		bIsAttacking = true;
 
+		// Enemy attacks don't activate abilities, so refresh hits here
+		if(UMyAbilitySystemComponent *ASC = GetMyAbilitySystem())
+		{
+			ASC->RefreshDamageSpecs();
+		}
+
 		// Face the player before attacking
 		FVector Direction = Player->GetActorLocation() - GetActorLocation();
 		Direction.Z =
@@ -131,10 +220,20 @@ void AMyEnemy::AttackPlayer(ACharacter *Player)
 					// Clear previous binding to avoid multiple calls
 					AnimInstance->OnMontageEnded.RemoveDynamic(
 						this, &AMyEnemy::OnAttackMontageEnded);
-					AnimInstance->Montage_Play(AttackMontage);
+					const float PlayRate = 1.0f;
+					AnimInstance->Montage_Play(AttackMontage, PlayRate);
 					// Bind to montage end to reset attack state
 					AnimInstance->OnMontageEnded.AddDynamic(
 						this, &AMyEnemy::OnAttackMontageEnded);
+
+					// Fire its notifies without pose evaluation on servers
+					if(UMyMontageTimelineSubsystem *Timeline =
+							GetWorld()
+								->GetSubsystem<UMyMontageTimelineSubsystem>())
+					{
+						Timeline->StartMontage(
+							this, AttackMontage, PlayRate);
+					}
 				}
 			}
 		}
@@ -146,16 +245,28 @@ void AMyEnemy::AttackPlayer(ACharacter *Player)
 void AMyEnemy::ResetAttackState()
 {
 	bIsAttacking = false;
+	OnAttackFinished.Broadcast();
 }
 
 void AMyEnemy::OnAttackMontageEnded(UAnimMontage *Montage, bool bInterrupted)
 {
+	StopTimelineMontage(Montage);
+
 	if(Montage == AttackMontage)
 	{
 		ResetAttackState();
 	}
 }
 
+void AMyEnemy::StopTimelineMontage(const UAnimMontage *Montage)
+{
+	if(UMyMontageTimelineSubsystem *Timeline =
+			GetWorld()->GetSubsystem<UMyMontageTimelineSubsystem>())
+	{
+		Timeline->StopMontage(this, Montage);
+	}
+}
+
 UAbilitySystemComponent *AMyEnemy::GetAbilitySystem() const
 {
 	return AttributeComponent ? AttributeComponent->GetAbilitySystemComponent()
@@ -164,50 +275,162 @@ UAbilitySystemComponent *AMyEnemy::GetAbilitySystem() const
 
 void AMyEnemy::HandleDeath()
 {
+	// Death clears stun
+	GetWorldTimerManager().ClearTimer(StunTimerHandle);
+	bIsStunned = false;
+
+	// Play the death at full rate; dead enemies are no longer targets
+	UnregisterFromWorldSubsystems();
+
+	// Stop thinking, so perception isn't queried (and re-registered) again
+	if(AMyEnemyAIController *AIController =
+			Cast<AMyEnemyAIController>(GetController()))
+	{
+		AIController->StopBehavior();
+	}
+
 	SetActorTickEnabled(false);
 	GetCharacterMovement()->DisableMovement();
 
 	// Set dead state for animation blueprint
 	bIsDead = true;
 
-	// If no death animation, destroy after delay
-	FTimerHandle DeathTimer;
-	GetWorld()->GetTimerManager().SetTimer(
-		DeathTimer, [this]() { Destroy(); }, DeathDelay, false);
+	// No more attack notifies from the server timeline
+	StopTimelineMontage(nullptr);
+
+	// Stop receiving hits
+	if(HurtboxComponent)
+	{
+		HurtboxComponent->DisableHurtbox();
+	}
+
+	// Pool or destroy once the death animation had time to play
+	GetWorldTimerManager().SetTimer(DeathTimerHandle, this,
+		&AMyEnemy::OnDeathFinished, DeathDelay, false);
 }
 
-void AMyEnemy::OnEnemyHealthChanged(float NewHealth)
+void AMyEnemy::OnDeathFinished()
 {
-	UpdateHealthBar();
+	UMyEnemyPoolSubsystem *Pool =
+		bReturnToPoolOnDeath ? GetWorld()->GetSubsystem<UMyEnemyPoolSubsystem>()
+							 : nullptr;
+	if(Pool)
+	{
+		Pool->ReleaseEnemy(this);
+	}
+	else
+	{
+		Destroy();
+	}
 }
 
-float AMyEnemy::TakeDamage(float DamageAmount, const FDamageEvent &DamageEvent,
-	AController *EventInstigator, AActor *DamageCauser)
+void AMyEnemy::DeactivateForPool()
 {
-	float ActualDamage = Super::TakeDamage(
-		DamageAmount, DamageEvent, EventInstigator, DamageCauser);
+	GetWorldTimerManager().ClearAllTimersForObject(this);
+	UnregisterFromWorldSubsystems();
 
-	// Update health bar after damage is applied through GAS
+	if(UMyHitHistorySubsystem *HitHistory =
+			GetWorld()->GetSubsystem<UMyHitHistorySubsystem>())
+	{
+		HitHistory->UnregisterCharacter(this);
+	}
+
+	if(AMyEnemyAIController *AIController =
+			Cast<AMyEnemyAIController>(GetController()))
+	{
+		AIController->StopBehavior();
+	}
+
+	StopTimelineMontage(nullptr);
+	if(UAnimInstance *AnimInstance = GetMesh()->GetAnimInstance())
+	{
+		AnimInstance->StopAllMontages(0.0f);
+	}
+
+	GetCharacterMovement()->StopMovementImmediately();
+	GetCharacterMovement()->DisableMovement();
+	if(HurtboxComponent)
+	{
+		HurtboxComponent->DisableHurtbox();
+	}
+	SetHealthBarVisible(false);
+	SetActorTickEnabled(false);
+	SetActorEnableCollision(false);
+	SetActorHiddenInGame(true);
+}
+
+void AMyEnemy::ReactivateFromPool(const FTransform &Transform)
+{
+	SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(true);
+
+	// Back to the state of a freshly spawned enemy
+	bIsDead = false;
+	bIsAttacking = false;
+	bIsStunned = false;
+	LastAttackTime = 0.0f;
+	PlayerCharacter = nullptr;
+	SetFocused(false);
+
+	if(AttributeComponent)
+	{
+		AttributeComponent->ResetAbilitySystem();
+	}
+	if(HurtboxComponent)
+	{
+		HurtboxComponent->EnableHurtbox();
+	}
+	GetCharacterMovement()->SetMovementMode(MOVE_Walking);
 	UpdateHealthBar();
 
+	RegisterWithWorldSubsystems();
+	if(HasAuthority())
+	{
+		if(UMyHitHistorySubsystem *HitHistory =
+				GetWorld()->GetSubsystem<UMyHitHistorySubsystem>())
+		{
+			HitHistory->RegisterCharacter(this);
+		}
+	}
+
+	if(AMyEnemyAIController *AIController =
+			Cast<AMyEnemyAIController>(GetController()))
+	{
+		AIController->RestartBehavior();
+	}
+}
+
+void AMyEnemy::OnEnemyHealthChanged(float NewHealth)
+{
+	UpdateHealthBar();
+}
+
+void AMyEnemy::OnDamageResolved(float DamageAmount, AActor *DamageCauser)
+{
+	// Health bar was already refreshed by OnEnemyHealthChanged
+
 	// Check if dead using GAS health
 	if(AttributeComponent && AttributeComponent->GetHealth() <= 0.0f)
 	{
-		// Death clears stun
-		SetStunned(false);
-		HandleDeath();
+		if(!bIsDead)
+		{
+			HandleDeath();
+		}
 	}
 	else
 	{
 		// Stun when taking damage but not dead
-		SetStunned(true);
-		// Reset stun after duration
-		FTimerHandle StunTimer;
-		GetWorld()->GetTimerManager().SetTimer(
-			StunTimer, [this]() { SetStunned(false); }, StunDuration, false);
-	}
+		StunFor(StunDuration);
 
-	return ActualDamage;
+		// Hits from outside detection range still wake a dormant enemy
+		if(UMyEnemyLODSubsystem *LODSubsystem =
+				GetWorld()->GetSubsystem<UMyEnemyLODSubsystem>())
+		{
+			LODSubsystem->WakeEnemy(this);
+		}
+	}
 }
 
 void AMyEnemy::SetStunned(bool bStunned)
@@ -219,6 +442,20 @@ void AMyEnemy::SetStunned(bool bStunned)
 		bIsStunned ? MOVE_None : MOVE_Walking);
 }
 
+void AMyEnemy::StunFor(float Duration)
+{
+	SetStunned(true);
+
+	// Reset stun after duration
+	GetWorldTimerManager().SetTimer(
+		StunTimerHandle, this, &AMyEnemy::ClearStun, Duration, false);
+}
+
+void AMyEnemy::ClearStun()
+{
+	SetStunned(false);
+}
+
 void AMyEnemy::SetHealthBarVisible(bool bVisible)
 {
 	if(HealthBarWidget)
@@ -6,6 +6,7 @@
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "MyEnemy.h"
+#include "MyWanderPointSubsystem.h"
 
 AMyEnemyAIController::AMyEnemyAIController()
 {
@@ -30,22 +31,19 @@ void AMyEnemyAIController::OnPossess(APawn *InPawn)
 		BlackboardComponent->InitializeBlackboard(
 			*BehaviorTree->BlackboardAsset);
 
-		// Set attack range in blackboard for dynamic behavior
-		AMyEnemy *Enemy = Cast<AMyEnemy>(InPawn);
-		if(Enemy)
+		// Resolve key IDs once; a missing key is an asset setup error
+		if(BehaviorTree->BlackboardAsset)
 		{
-			BlackboardComponent->SetValueAsFloat(
-				FName("AttackRange"), Enemy->AttackRange);
+			const TArray<FName> MissingKeys =
+				BlackboardKeys.Resolve(*BehaviorTree->BlackboardAsset);
+			ensureMsgf(MissingKeys.Num() == 0,
+				TEXT("Blackboard %s is missing keys: %s"),
+				*BehaviorTree->BlackboardAsset->GetName(),
+				*FString::JoinBy(MissingKeys, TEXT(", "),
+					[](const FName &KeyName) { return KeyName.ToString(); }));
 		}
 
-		// Set patrol points in blackboard
-		if(Enemy && Enemy->PatrolPoints.Num() > 0)
-		{
-			BlackboardComponent->SetValueAsVector(FName("PatrolLocation"),
-				Enemy->PatrolPoints[0]->GetActorLocation());
-		}
-
-		BehaviorTreeComponent->StartTree(*BehaviorTree);
+		StartBehavior();
 	}
 	else
 	{
@@ -58,3 +56,56 @@ void AMyEnemyAIController::OnUnPossess()
 
 	BehaviorTreeComponent->StopTree();
 }
+
+void AMyEnemyAIController::StopBehavior()
+{
+	// Stopping the tree doesn't stop async wander queries already issued
+	if(UMyWanderPointSubsystem *WanderPoints =
+			GetWorld()->GetSubsystem<UMyWanderPointSubsystem>())
+	{
+		WanderPoints->CancelWanderMove(this);
+	}
+
+	StopMovement();
+	BehaviorTreeComponent->StopTree(EBTStopMode::Forced);
+}
+
+void AMyEnemyAIController::RestartBehavior()
+{
+	if(!BehaviorTree)
+	{
+		return;
+	}
+
+	StopBehavior();
+
+	// Nothing from the previous life (target, patrol state) carries over
+	for(FBlackboard::FKey KeyID = 0; KeyID < BlackboardComponent->GetNumKeys();
+		++KeyID)
+	{
+		BlackboardComponent->ClearValue(KeyID);
+	}
+
+	StartBehavior();
+}
+
+void AMyEnemyAIController::StartBehavior()
+{
+	// Set attack range in blackboard for dynamic behavior
+	AMyEnemy *Enemy = Cast<AMyEnemy>(GetPawn());
+	if(Enemy)
+	{
+		MyBlackboard::SetFloat(BlackboardComponent,
+			BlackboardKeys.AttackRange, Enemy->AttackRange);
+	}
+
+	// Set patrol points in blackboard
+	if(Enemy && Enemy->PatrolPoints.Num() > 0)
+	{
+		MyBlackboard::SetVector(BlackboardComponent,
+			BlackboardKeys.PatrolLocation,
+			Enemy->PatrolPoints[0]->GetActorLocation());
+	}
+
+	BehaviorTreeComponent->StartTree(*BehaviorTree);
+}
@@ -0,0 +1,356 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyEnemyLODSubsystem.h"
+
+#include "AIController.h"
+#include "ActionRPG.h"
+#include "BrainComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "MyEnemy.h"
+#include "MyGameConfig.h"
+#include "MyPlayerRegistrySubsystem.h"
+#include "MyWanderPointSubsystem.h"
+#include "SignificanceManager.h"
+
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Enemy LOD Near"), STAT_EnemyLODNear, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Enemy LOD Mid"), STAT_EnemyLODMid, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Enemy LOD Far"), STAT_EnemyLODFar, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Enemy LOD Dormant"), STAT_EnemyLODDormant, STATGROUP_ActionRPG);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Enemy LOD Near Est. Ticks / Frame"),
+	STAT_EnemyLODNearTicks, STATGROUP_ActionRPG);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Enemy LOD Mid Est. Ticks / Frame"),
+	STAT_EnemyLODMidTicks, STATGROUP_ActionRPG);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Enemy LOD Far Est. Ticks / Frame"),
+	STAT_EnemyLODFarTicks, STATGROUP_ActionRPG);
+DECLARE_CYCLE_STAT(TEXT("Update Enemy LOD"), STAT_UpdateEnemyLOD,
+	STATGROUP_ActionRPG);
+
+namespace
+{
+const FName EnemySignificanceTag = FName("Enemy");
+
+// Ticks per frame of a component ticking every Interval seconds
+float GetTicksPerFrame(float Interval, float DeltaTime)
+{
+	return Interval > DeltaTime ? DeltaTime / Interval : 1.0f;
+}
+} // namespace
+
+void UMyEnemyLODSubsystem::Deinitialize()
+{
+	EnemyBuckets.Empty();
+	WakeUntilTimes.Empty();
+
+	Super::Deinitialize();
+}
+
+void UMyEnemyLODSubsystem::RegisterEnemy(AMyEnemy *Enemy)
+{
+	USignificanceManager *SignificanceManager =
+		USignificanceManager::Get(GetWorld());
+	if(!Enemy || !SignificanceManager || EnemyBuckets.Contains(Enemy))
+	{
+		return;
+	}
+
+	// Enemies start at full rate, which is the Near bucket
+	EnemyBuckets.Add(Enemy, EMyEnemyLODBucket::Near);
+	BucketPopulations[static_cast<int32>(EMyEnemyLODBucket::Near)]++;
+
+	SignificanceManager->RegisterObject(Enemy, EnemySignificanceTag,
+		[this](USignificanceManager::FManagedObjectInfo *ObjectInfo,
+			const FTransform &Viewpoint) {
+			return CalculateSignificance(
+				Cast<AMyEnemy>(ObjectInfo->GetObject()), Viewpoint);
+		},
+		USignificanceManager::EPostSignificanceType::Sequential,
+		[this](USignificanceManager::FManagedObjectInfo *ObjectInfo,
+			float OldSignificance, float Significance, bool bFinal) {
+			if(!bFinal && OldSignificance != Significance)
+			{
+				ApplyBucket(Cast<AMyEnemy>(ObjectInfo->GetObject()),
+					static_cast<EMyEnemyLODBucket>(
+						FMath::RoundToInt32(Significance)));
+			}
+		});
+}
+
+void UMyEnemyLODSubsystem::UnregisterEnemy(AMyEnemy *Enemy)
+{
+	EMyEnemyLODBucket Bucket = EMyEnemyLODBucket::Near;
+	if(!EnemyBuckets.RemoveAndCopyValue(Enemy, Bucket))
+	{
+		return;
+	}
+
+	BucketPopulations[static_cast<int32>(Bucket)]--;
+	WakeUntilTimes.Remove(Enemy);
+	ResetEnemy(Enemy, Bucket);
+
+	if(USignificanceManager *SignificanceManager =
+			USignificanceManager::Get(GetWorld()))
+	{
+		SignificanceManager->UnregisterObject(Enemy);
+	}
+}
+
+void UMyEnemyLODSubsystem::WakeEnemy(AMyEnemy *Enemy)
+{
+	if(!Enemy || !EnemyBuckets.Contains(Enemy))
+	{
+		return;
+	}
+
+	const float WakeDuration = FGameConfig::GetDefault().EnemyWakeDuration;
+	WakeUntilTimes.Add(Enemy, GetWorld()->GetTimeSeconds() + WakeDuration);
+
+	// Don't wait for the next update to resume
+	if(EnemyBuckets[Enemy] == EMyEnemyLODBucket::Dormant)
+	{
+		ApplyBucket(Enemy, EMyEnemyLODBucket::Far);
+	}
+}
+
+EMyEnemyLODBucket UMyEnemyLODSubsystem::GetBucket(const AMyEnemy *Enemy) const
+{
+	const EMyEnemyLODBucket *Bucket = EnemyBuckets.Find(Enemy);
+	return Bucket ? *Bucket : EMyEnemyLODBucket::Near;
+}
+
+void UMyEnemyLODSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_UpdateEnemyLOD);
+
+	UWorld *World = GetWorld();
+	USignificanceManager *SignificanceManager =
+		USignificanceManager::Get(World);
+	if(!World || !SignificanceManager || EnemyBuckets.Num() == 0)
+	{
+		return;
+	}
+
+	// Every player is a viewpoint; an enemy takes its highest significance
+	TArray<ACharacter *> Players;
+	if(const UMyPlayerRegistrySubsystem *PlayerRegistry =
+			World->GetSubsystem<UMyPlayerRegistrySubsystem>())
+	{
+		PlayerRegistry->GetPlayers(Players);
+	}
+
+	TArray<FTransform, TInlineAllocator<16>> Viewpoints;
+	for(const ACharacter *Player : Players)
+	{
+		Viewpoints.Add(Player->GetActorTransform());
+	}
+
+	// No rendering on a dedicated server, so only distance counts there
+	UpdateTime = World->GetTimeSeconds();
+	bUseVisibility = World->GetNetMode() != NM_DedicatedServer;
+	SignificanceManager->Update(Viewpoints);
+
+	SET_DWORD_STAT(STAT_EnemyLODNear,
+		BucketPopulations[static_cast<int32>(EMyEnemyLODBucket::Near)]);
+	SET_DWORD_STAT(STAT_EnemyLODMid,
+		BucketPopulations[static_cast<int32>(EMyEnemyLODBucket::Mid)]);
+	SET_DWORD_STAT(STAT_EnemyLODFar,
+		BucketPopulations[static_cast<int32>(EMyEnemyLODBucket::Far)]);
+	SET_DWORD_STAT(STAT_EnemyLODDormant,
+		BucketPopulations[static_cast<int32>(EMyEnemyLODBucket::Dormant)]);
+
+	// BT, movement and animation ticks per frame each bucket is expected to
+	// run, worked out from its intervals. This is not measured time: the
+	// engine ticks those components itself, so per-bucket time isn't
+	// available here; use stat game or Insights for that.
+	auto GetBucketTicks = [this, DeltaTime](EMyEnemyLODBucket Bucket) {
+		const FBucketSettings Settings = GetBucketSettings(Bucket);
+		const float TicksPerEnemy =
+			GetTicksPerFrame(Settings.BTInterval, DeltaTime)
+			+ GetTicksPerFrame(Settings.MovementInterval, DeltaTime)
+			+ GetTicksPerFrame(Settings.AnimInterval, DeltaTime);
+		return TicksPerEnemy * BucketPopulations[static_cast<int32>(Bucket)];
+	};
+	SET_FLOAT_STAT(
+		STAT_EnemyLODNearTicks, GetBucketTicks(EMyEnemyLODBucket::Near));
+	SET_FLOAT_STAT(
+		STAT_EnemyLODMidTicks, GetBucketTicks(EMyEnemyLODBucket::Mid));
+	SET_FLOAT_STAT(
+		STAT_EnemyLODFarTicks, GetBucketTicks(EMyEnemyLODBucket::Far));
+}
+
+UMyEnemyLODSubsystem::FBucketSettings UMyEnemyLODSubsystem::GetBucketSettings(
+	EMyEnemyLODBucket Bucket)
+{
+	const FGameConfig &Config = FGameConfig::GetDefault();
+
+	FBucketSettings Settings;
+	switch(Bucket)
+	{
+	case EMyEnemyLODBucket::Near:
+		break; // Full rate
+	case EMyEnemyLODBucket::Mid:
+		Settings.BTInterval = Config.EnemyLODMidBTInterval;
+		Settings.MovementInterval = Config.EnemyLODMidMovementInterval;
+		Settings.AnimInterval = Config.EnemyLODMidAnimInterval;
+		break;
+	case EMyEnemyLODBucket::Far:
+		Settings.BTInterval = Config.EnemyLODFarBTInterval;
+		Settings.MovementInterval = Config.EnemyLODFarMovementInterval;
+		Settings.AnimInterval = Config.EnemyLODFarAnimInterval;
+		break;
+	default:
+		break; // Dormant components don't tick at all
+	}
+	return Settings;
+}
+
+float UMyEnemyLODSubsystem::CalculateSignificance(
+	const AMyEnemy *Enemy, const FTransform &Viewpoint) const
+{
+	if(!Enemy)
+	{
+		return static_cast<float>(EMyEnemyLODBucket::Dormant);
+	}
+
+	const FGameConfig &Config = FGameConfig::GetDefault();
+	const double DistSq = FVector::DistSquared(
+		Enemy->GetActorLocation(), Viewpoint.GetLocation());
+
+	EMyEnemyLODBucket Bucket = EMyEnemyLODBucket::Dormant;
+	if(DistSq <= FMath::Square(Config.EnemyLODNearDistance))
+	{
+		Bucket = EMyEnemyLODBucket::Near;
+	}
+	else if(DistSq <= FMath::Square(Config.EnemyLODMidDistance))
+	{
+		Bucket = EMyEnemyLODBucket::Mid;
+	}
+	else if(DistSq <= FMath::Square(Config.EnemyDetectionRange))
+	{
+		Bucket = EMyEnemyLODBucket::Far;
+	}
+
+	// Unseen enemies drop one bucket but never go dormant from it
+	if(bUseVisibility && Bucket > EMyEnemyLODBucket::Far
+		&& !Enemy->WasRecentlyRendered())
+	{
+		Bucket = static_cast<EMyEnemyLODBucket>(static_cast<uint8>(Bucket) - 1);
+	}
+
+	// Woken enemies stay awake for a while wherever they are
+	if(Bucket == EMyEnemyLODBucket::Dormant)
+	{
+		const double *WakeUntil = WakeUntilTimes.Find(Enemy);
+		if(WakeUntil && *WakeUntil > UpdateTime)
+		{
+			Bucket = EMyEnemyLODBucket::Far;
+		}
+	}
+
+	return static_cast<float>(Bucket);
+}
+
+void UMyEnemyLODSubsystem::ApplyBucket(
+	AMyEnemy *Enemy, EMyEnemyLODBucket NewBucket)
+{
+	// A woken enemy may already be in the bucket the manager moves it to
+	EMyEnemyLODBucket *TrackedBucket = EnemyBuckets.Find(Enemy);
+	if(!Enemy || !TrackedBucket || *TrackedBucket == NewBucket)
+	{
+		return;
+	}
+
+	const EMyEnemyLODBucket OldBucket = *TrackedBucket;
+	BucketPopulations[static_cast<int32>(*TrackedBucket)]--;
+	BucketPopulations[static_cast<int32>(NewBucket)]++;
+	*TrackedBucket = NewBucket;
+
+	const FBucketSettings Settings = GetBucketSettings(NewBucket);
+	const bool bDormant = NewBucket == EMyEnemyLODBucket::Dormant;
+
+	if(UCharacterMovementComponent *Movement = Enemy->GetCharacterMovement())
+	{
+		Movement->SetComponentTickInterval(Settings.MovementInterval);
+		Movement->SetComponentTickEnabled(!bDormant);
+	}
+
+	if(USkeletalMeshComponent *Mesh = Enemy->GetMesh())
+	{
+		Mesh->SetComponentTickInterval(Settings.AnimInterval);
+		Mesh->SetComponentTickEnabled(!bDormant);
+	}
+
+	AAIController *Controller = Cast<AAIController>(Enemy->GetController());
+	UBrainComponent *Brain =
+		Controller ? Controller->GetBrainComponent() : nullptr;
+	if(Brain)
+	{
+		Brain->SetComponentTickInterval(Settings.BTInterval);
+		if(bDormant)
+		{
+			// Pausing keeps the wander task running; drop its pending path
+			if(UMyWanderPointSubsystem *WanderPoints =
+					GetWorld()->GetSubsystem<UMyWanderPointSubsystem>())
+			{
+				WanderPoints->CancelWanderMove(Controller);
+			}
+			Controller->StopMovement();
+			Brain->PauseLogic(TEXT("Dormant"));
+		}
+		else if(OldBucket == EMyEnemyLODBucket::Dormant)
+		{
+			Brain->ResumeLogic(TEXT("Dormant"));
+		}
+	}
+}
+
+void UMyEnemyLODSubsystem::ResetEnemy(
+	AMyEnemy *Enemy, EMyEnemyLODBucket OldBucket)
+{
+	if(!Enemy)
+	{
+		return;
+	}
+
+	if(UCharacterMovementComponent *Movement = Enemy->GetCharacterMovement())
+	{
+		Movement->SetComponentTickInterval(0.0f);
+		Movement->SetComponentTickEnabled(true);
+	}
+
+	if(USkeletalMeshComponent *Mesh = Enemy->GetMesh())
+	{
+		Mesh->SetComponentTickInterval(0.0f);
+		Mesh->SetComponentTickEnabled(true);
+	}
+
+	AAIController *Controller = Cast<AAIController>(Enemy->GetController());
+	UBrainComponent *Brain =
+		Controller ? Controller->GetBrainComponent() : nullptr;
+	if(Brain)
+	{
+		Brain->SetComponentTickInterval(0.0f);
+		if(OldBucket == EMyEnemyLODBucket::Dormant)
+		{
+			Brain->ResumeLogic(TEXT("Dormant"));
+		}
+	}
+}
+
+TStatId UMyEnemyLODSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMyEnemyLODSubsystem, STATGROUP_Tickables);
+}
+
+bool UMyEnemyLODSubsystem::DoesSupportWorldType(
+	const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,145 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyEnemyPoolSubsystem.h"
+
+#include "ActionRPG.h"
+#include "Engine/World.h"
+#include "MyEnemy.h"
+#include "MyGameConfig.h"
+
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Enemy Pool Spawns"), STAT_EnemyPoolSpawns, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Enemy Pool Reuses"), STAT_EnemyPoolReuses, STATGROUP_ActionRPG);
+DECLARE_DWORD_ACCUMULATOR_STAT(
+	TEXT("Pooled Enemies"), STAT_PooledEnemies, STATGROUP_ActionRPG);
+
+void UMyEnemyPoolSubsystem::Deinitialize()
+{
+	// Pooled actors are torn down with the world
+	Pools.Empty();
+	SET_DWORD_STAT(STAT_PooledEnemies, 0);
+
+	Super::Deinitialize();
+}
+
+AMyEnemy *UMyEnemyPoolSubsystem::AcquireEnemy(
+	TSubclassOf<AMyEnemy> EnemyClass, const FTransform &Transform)
+{
+	if(!EnemyClass)
+	{
+		return nullptr;
+	}
+
+	if(AMyEnemy *Enemy = TryReuseEnemy(EnemyClass, Transform))
+	{
+		return Enemy;
+	}
+	return SpawnEnemy(EnemyClass, Transform);
+}
+
+AMyEnemy *UMyEnemyPoolSubsystem::TryReuseEnemy(
+	TSubclassOf<AMyEnemy> EnemyClass, const FTransform &Transform)
+{
+	if(FMyEnemyPool *Pool = Pools.Find(EnemyClass))
+	{
+		while(Pool->Enemies.Num() > 0)
+		{
+			AMyEnemy *Enemy = Pool->Enemies.Pop(EAllowShrinking::No);
+			DEC_DWORD_STAT(STAT_PooledEnemies);
+			if(IsValid(Enemy))
+			{
+				Counters.Reuses++;
+				INC_DWORD_STAT(STAT_EnemyPoolReuses);
+				Enemy->ReactivateFromPool(Transform);
+				return Enemy;
+			}
+		}
+	}
+	return nullptr;
+}
+
+void UMyEnemyPoolSubsystem::ReleaseEnemy(AMyEnemy *Enemy)
+{
+	if(!IsValid(Enemy))
+	{
+		return;
+	}
+
+	FMyEnemyPool &Pool = Pools.FindOrAdd(Enemy->GetClass());
+	if(Pool.Enemies.Contains(Enemy))
+	{
+		return;
+	}
+
+	if(Pool.Enemies.Num() >= FGameConfig::GetDefault().EnemyPoolMaxPerClass)
+	{
+		Counters.Overflows++;
+		Enemy->Destroy();
+		return;
+	}
+
+	Enemy->DeactivateForPool();
+	Pool.Enemies.Add(Enemy);
+	Counters.Releases++;
+	INC_DWORD_STAT(STAT_PooledEnemies);
+}
+
+void UMyEnemyPoolSubsystem::PrewarmEnemies(
+	TSubclassOf<AMyEnemy> EnemyClass, int32 Count)
+{
+	if(!EnemyClass)
+	{
+		return;
+	}
+
+	const int32 NumPooled = Pools.FindOrAdd(EnemyClass).Enemies.Num();
+	for(int32 Index = NumPooled; Index < Count; ++Index)
+	{
+		if(AMyEnemy *Enemy = SpawnEnemy(EnemyClass, FTransform::Identity))
+		{
+			ReleaseEnemy(Enemy);
+		}
+	}
+}
+
+int32 UMyEnemyPoolSubsystem::GetNumPooled() const
+{
+	int32 NumPooled = 0;
+	for(const TPair<UClass *, FMyEnemyPool> &Pair : Pools)
+	{
+		NumPooled += Pair.Value.Enemies.Num();
+	}
+	return NumPooled;
+}
+
+AMyEnemy *UMyEnemyPoolSubsystem::SpawnEnemy(
+	TSubclassOf<AMyEnemy> EnemyClass, const FTransform &Transform)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride =
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	AMyEnemy *Enemy = GetWorld()->SpawnActor<AMyEnemy>(
+		EnemyClass, Transform, SpawnParams);
+	if(!Enemy)
+	{
+		return nullptr;
+	}
+
+	// Placed enemies are possessed automatically; spawned ones are not
+	if(!Enemy->GetController())
+	{
+		Enemy->SpawnDefaultController();
+	}
+
+	Counters.Spawns++;
+	INC_DWORD_STAT(STAT_EnemyPoolSpawns);
+	return Enemy;
+}
+
+bool UMyEnemyPoolSubsystem::DoesSupportWorldType(
+	const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
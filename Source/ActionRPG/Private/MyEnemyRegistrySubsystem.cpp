@@ -0,0 +1,467 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyEnemyRegistrySubsystem.h"
+
+#include "ActionRPG.h"
+#include "MyEnemy.h"
+#include "MyGameConfig.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Registered Enemies"),
+	STAT_RegisteredEnemies, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Enemy Registry Rehashes"),
+	STAT_EnemyRegistryRehashes, STATGROUP_ActionRPG);
+DECLARE_CYCLE_STAT(TEXT("Enemy Registry Query"), STAT_EnemyRegistryQuery,
+	STATGROUP_ActionRPG);
+DECLARE_CYCLE_STAT(TEXT("Enemy Range Watch Update"), STAT_EnemyRangeWatch,
+	STATGROUP_ActionRPG);
+
+void UMyEnemyRegistrySubsystem::Initialize(
+	FSubsystemCollectionBase &Collection)
+{
+	Super::Initialize(Collection);
+
+	Grid.SetCellSize(FGameConfig::GetDefault().EnemyRegistryCellSize);
+}
+
+void UMyEnemyRegistrySubsystem::RegisterEnemy(AMyEnemy *Enemy)
+{
+	if(!Enemy || EntryIndices.Contains(Enemy))
+	{
+		return;
+	}
+
+	const int32 Index = Entries.Num();
+	FEnemyEntry &Entry = Entries.AddDefaulted_GetRef();
+	Entry.Key = Enemy;
+	Entry.Enemy = Enemy;
+	Entry.Cell = Grid.GetCell(Enemy->GetActorLocation());
+	EntryIndices.Add(Enemy, Index);
+	Grid.Add(Index, Entry.Cell);
+	RefreshInWatches(Index);
+}
+
+void UMyEnemyRegistrySubsystem::UnregisterEnemy(AMyEnemy *Enemy)
+{
+	if(const int32 *Index = EntryIndices.Find(Enemy))
+	{
+		RemoveEntryAt(*Index);
+	}
+}
+
+void UMyEnemyRegistrySubsystem::GetEnemiesInRadius(const FVector &Location,
+	float Radius, TArray<AMyEnemy *> &OutEnemies) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_EnemyRegistryQuery);
+
+	const double RadiusSq = FMath::Square(static_cast<double>(Radius));
+	Grid.ForEachInRadius(Location, Radius, [&](int32 Index) {
+		double DistSq = 0.0;
+		if(AMyEnemy *Enemy =
+				GetEnemyInRange(Index, Location, RadiusSq, DistSq))
+		{
+			OutEnemies.Add(Enemy);
+		}
+	});
+}
+
+void UMyEnemyRegistrySubsystem::FindNearestEnemies(const FVector &Location,
+	float Radius, int32 Count, TArray<AMyEnemy *> &OutEnemies) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_EnemyRegistryQuery);
+
+	if(Count <= 0)
+	{
+		return;
+	}
+
+	struct FCandidate
+	{
+		double DistSq;
+		AMyEnemy *Enemy;
+	};
+
+	// Max-heap on distance holding the best Count candidates so far
+	const auto FartherFirst = [](const FCandidate &A, const FCandidate &B) {
+		return A.DistSq > B.DistSq;
+	};
+
+	TArray<FCandidate, TInlineAllocator<16>> Heap;
+	double RadiusSq = FMath::Square(static_cast<double>(Radius));
+	const auto Consider = [&](int32 Index) {
+		double DistSq = 0.0;
+		AMyEnemy *Enemy = GetEnemyInRange(Index, Location, RadiusSq, DistSq);
+		if(!Enemy)
+		{
+			return;
+		}
+
+		if(Heap.Num() == Count)
+		{
+			Heap.HeapPopDiscard(FartherFirst, EAllowShrinking::No);
+		}
+		Heap.HeapPush(FCandidate{DistSq, Enemy}, FartherFirst);
+
+		// Once full, only closer enemies than the worst kept can enter
+		if(Heap.Num() == Count)
+		{
+			RadiusSq = Heap.HeapTop().DistSq;
+		}
+	};
+
+	const double CellSize = Grid.GetCellSize();
+	const int32 MaxRing = FMath::CeilToInt32(Radius / CellSize);
+	const int64 RingsSide = 2 * static_cast<int64>(MaxRing) + 1;
+	if(RingsSide * RingsSide > Grid.GetNumCells())
+	{
+		// Fewer occupied cells than the rings would visit; scan them all
+		Grid.ForEachInRadius(Location, Radius, Consider);
+	}
+	else
+	{
+		// Search outward ring by ring and stop once the farthest kept
+		// enemy is closer than anything the next ring could hold
+		const FIntPoint Center = Grid.GetCell(Location);
+		for(int32 Ring = 0; Ring <= MaxRing; ++Ring)
+		{
+			Grid.ForEachInRing(Center, Ring, Consider);
+
+			if(Heap.Num() == Count
+				&& Heap.HeapTop().DistSq <= FMath::Square(Ring * CellSize))
+			{
+				break;
+			}
+		}
+	}
+
+	// Popping the max-heap yields farthest first; fill back to front
+	const int32 FirstOut = OutEnemies.Num();
+	OutEnemies.AddUninitialized(Heap.Num());
+	for(int32 OutIndex = OutEnemies.Num() - 1; OutIndex >= FirstOut;
+		--OutIndex)
+	{
+		OutEnemies[OutIndex] = Heap.HeapTop().Enemy;
+		Heap.HeapPopDiscard(FartherFirst, EAllowShrinking::No);
+	}
+}
+
+void UMyEnemyRegistrySubsystem::GetEnemiesInCone(const FVector &Origin,
+	const FVector &Direction, float HalfAngleDegrees, float Radius,
+	TArray<AMyEnemy *> &OutEnemies) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_EnemyRegistryQuery);
+
+	const double RadiusSq = FMath::Square(static_cast<double>(Radius));
+	const double CosHalfAngle =
+		FMath::Cos(FMath::DegreesToRadians(HalfAngleDegrees));
+	Grid.ForEachInRadius(Origin, Radius, [&](int32 Index) {
+		double DistSq = 0.0;
+		AMyEnemy *Enemy = GetEnemyInRange(Index, Origin, RadiusSq, DistSq);
+		if(!Enemy)
+		{
+			return;
+		}
+
+		const FVector ToEnemy =
+			(Enemy->GetActorLocation() - Origin).GetSafeNormal();
+		if(FVector::DotProduct(ToEnemy, Direction) >= CosHalfAngle)
+		{
+			OutEnemies.Add(Enemy);
+		}
+	});
+}
+
+int32 UMyEnemyRegistrySubsystem::AddRangeWatch(float Radius)
+{
+	int32 WatchId = Watches.IndexOfByPredicate(
+		[](const FRangeWatch &Watch) { return !Watch.bInUse; });
+	if(WatchId == INDEX_NONE)
+	{
+		if(Watches.Num() == MaxRangeWatches)
+		{
+			return INDEX_NONE;
+		}
+		WatchId = Watches.AddDefaulted();
+	}
+
+	// Enemies join on the first update, once the watch has a center
+	FRangeWatch &Watch = Watches[WatchId];
+	Watch.bInUse = true;
+	Watch.Radius = FMath::Max(0.0f, Radius);
+	return WatchId;
+}
+
+void UMyEnemyRegistrySubsystem::RemoveRangeWatch(int32 WatchId)
+{
+	if(!Watches.IsValidIndex(WatchId))
+	{
+		return;
+	}
+
+	const uint32 Bit = 1u << WatchId;
+	for(FEnemyEntry &Entry : Entries)
+	{
+		Entry.WatchMask &= ~Bit;
+	}
+	Watches[WatchId] = FRangeWatch();
+}
+
+void UMyEnemyRegistrySubsystem::UpdateRangeWatch(int32 WatchId,
+	const FVector &Center, TArray<AMyEnemy *> &OutEntered,
+	TArray<TWeakObjectPtr<AMyEnemy>> &OutExited)
+{
+	SCOPE_CYCLE_COUNTER(STAT_EnemyRangeWatch);
+
+	if(!Watches.IsValidIndex(WatchId) || !Watches[WatchId].bInUse)
+	{
+		return;
+	}
+
+	FRangeWatch &Watch = Watches[WatchId];
+	const bool bWasPlaced = Watch.bPlaced;
+	const FVector2D OldCenter = Watch.Center;
+	Watch.bPlaced = true;
+	Watch.Center = FVector2D(Center);
+
+	// Tick already moved enemies that crossed a cell in or out. What is
+	// left are the cells the edge passes through, where enemies move in
+	// and out without crossing a cell, and the cells the move itself
+	// brought in or out of the circle.
+	const double RadiusSq = FMath::Square(Watch.Radius);
+	const auto NeedsRefresh = [&](const FIntPoint &Cell) {
+		const ECellCoverage Coverage =
+			GetCellCoverage(Cell, Watch.Center, RadiusSq);
+		const ECellCoverage OldCoverage =
+			bWasPlaced ? GetCellCoverage(Cell, OldCenter, RadiusSq)
+					   : ECellCoverage::Outside;
+		return Coverage == ECellCoverage::Partial || Coverage != OldCoverage;
+	};
+	const auto RefreshCell = [&](const FIntPoint &Cell) {
+		if(NeedsRefresh(Cell))
+		{
+			Grid.ForEachInCell(
+				Cell, [&](int32 Index) { RefreshInWatch(WatchId, Index); });
+		}
+	};
+
+	const FVector2D Extent(Watch.Radius);
+	const FIntPoint MinCell = Grid.GetCell(FVector(Watch.Center - Extent, 0.0));
+	const FIntPoint MaxCell = Grid.GetCell(FVector(Watch.Center + Extent, 0.0));
+	const FIntPoint OldMinCell =
+		bWasPlaced ? Grid.GetCell(FVector(OldCenter - Extent, 0.0)) : MinCell;
+	const FIntPoint OldMaxCell =
+		bWasPlaced ? Grid.GetCell(FVector(OldCenter + Extent, 0.0)) : MaxCell;
+	const auto IsInBounds = [&](const FIntPoint &Cell) {
+		return Cell.X >= MinCell.X && Cell.X <= MaxCell.X
+			&& Cell.Y >= MinCell.Y && Cell.Y <= MaxCell.Y;
+	};
+
+	const int64 NumBoundsCells =
+		static_cast<int64>(MaxCell.X - MinCell.X + 1)
+			* (MaxCell.Y - MinCell.Y + 1)
+		+ static_cast<int64>(OldMaxCell.X - OldMinCell.X + 1)
+			* (OldMaxCell.Y - OldMinCell.Y + 1);
+	if(NumBoundsCells > Entries.Num())
+	{
+		// Fewer enemies than cells to look at; check the enemies instead
+		for(int32 Index = 0; Index < Entries.Num(); ++Index)
+		{
+			if(NeedsRefresh(Entries[Index].Cell))
+			{
+				RefreshInWatch(WatchId, Index);
+			}
+		}
+	}
+	else
+	{
+		// Cells around the new center, then those only the old one had
+		for(int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+		{
+			for(int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+			{
+				RefreshCell(FIntPoint(CellX, CellY));
+			}
+		}
+		for(int32 CellY = OldMinCell.Y; CellY <= OldMaxCell.Y; ++CellY)
+		{
+			for(int32 CellX = OldMinCell.X; CellX <= OldMaxCell.X; ++CellX)
+			{
+				const FIntPoint Cell(CellX, CellY);
+				if(!IsInBounds(Cell))
+				{
+					RefreshCell(Cell);
+				}
+			}
+		}
+	}
+
+	for(const TPair<TWeakObjectPtr<AMyEnemy>, bool> &Change : Watch.Changes)
+	{
+		if(!Change.Value)
+		{
+			OutExited.Add(Change.Key);
+		}
+		else if(AMyEnemy *Enemy = Change.Key.Get())
+		{
+			OutEntered.Add(Enemy);
+		}
+	}
+	Watch.Changes.Reset();
+}
+
+void UMyEnemyRegistrySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Rehash enemies that crossed a cell boundary; drop destroyed ones
+	int32 NumRehashed = 0;
+	for(int32 Index = Entries.Num() - 1; Index >= 0; --Index)
+	{
+		const AMyEnemy *Enemy = Entries[Index].Enemy.Get();
+		if(!Enemy)
+		{
+			RemoveEntryAt(Index);
+			continue;
+		}
+
+		const FIntPoint Cell = Grid.GetCell(Enemy->GetActorLocation());
+		if(Cell != Entries[Index].Cell)
+		{
+			Grid.Remove(Index, Entries[Index].Cell);
+			Entries[Index].Cell = Cell;
+			Grid.Add(Index, Cell);
+			RefreshInWatches(Index);
+			++NumRehashed;
+		}
+	}
+
+	SET_DWORD_STAT(STAT_RegisteredEnemies, Entries.Num());
+	SET_DWORD_STAT(STAT_EnemyRegistryRehashes, NumRehashed);
+}
+
+void UMyEnemyRegistrySubsystem::RemoveEntryAt(int32 Index)
+{
+	// Report the enemy as gone to every watch it was inside of
+	for(uint32 Mask = Entries[Index].WatchMask; Mask != 0; Mask &= Mask - 1)
+	{
+		SetInWatch(FMath::CountTrailingZeros(Mask), Index, false);
+	}
+
+	const int32 LastIndex = Entries.Num() - 1;
+	Grid.Remove(Index, Entries[Index].Cell);
+	EntryIndices.Remove(Entries[Index].Key);
+
+	// Move the last entry into the hole and fix its cell and index
+	if(Index != LastIndex)
+	{
+		Grid.Remove(LastIndex, Entries[LastIndex].Cell);
+		Entries.Swap(Index, LastIndex);
+		Grid.Add(Index, Entries[Index].Cell);
+		EntryIndices.Add(Entries[Index].Key, Index);
+	}
+	Entries.RemoveAt(LastIndex, 1, EAllowShrinking::No);
+}
+
+AMyEnemy *UMyEnemyRegistrySubsystem::GetEnemyInRange(int32 Index,
+	const FVector &Location, double RadiusSq, double &OutDistSq) const
+{
+	AMyEnemy *Enemy = Entries[Index].Enemy.Get();
+	if(!Enemy || Enemy->bIsDead)
+	{
+		return nullptr;
+	}
+
+	OutDistSq = FVector::DistSquared(Enemy->GetActorLocation(), Location);
+	return OutDistSq <= RadiusSq ? Enemy : nullptr;
+}
+
+UMyEnemyRegistrySubsystem::ECellCoverage
+UMyEnemyRegistrySubsystem::GetCellCoverage(const FIntPoint &Cell,
+	const FVector2D &Center, double RadiusSq) const
+{
+	const double CellSize = Grid.GetCellSize();
+	const FVector2D Min(Cell.X * CellSize, Cell.Y * CellSize);
+	const FVector2D Max = Min + FVector2D(CellSize);
+
+	const FVector2D Nearest(FMath::Clamp(Center.X, Min.X, Max.X),
+		FMath::Clamp(Center.Y, Min.Y, Max.Y));
+	if(FVector2D::DistSquared(Nearest, Center) > RadiusSq)
+	{
+		return ECellCoverage::Outside;
+	}
+
+	const FVector2D Farthest(
+		Center.X - Min.X > Max.X - Center.X ? Min.X : Max.X,
+		Center.Y - Min.Y > Max.Y - Center.Y ? Min.Y : Max.Y);
+	return FVector2D::DistSquared(Farthest, Center) <= RadiusSq
+			   ? ECellCoverage::Inside
+			   : ECellCoverage::Partial;
+}
+
+void UMyEnemyRegistrySubsystem::RefreshInWatch(int32 WatchId, int32 Index)
+{
+	const FRangeWatch &Watch = Watches[WatchId];
+	const FEnemyEntry &Entry = Entries[Index];
+	const AMyEnemy *Enemy = Entry.Enemy.Get();
+
+	bool bInside = false;
+	if(Watch.bPlaced && Enemy && !Enemy->bIsDead)
+	{
+		const double RadiusSq = FMath::Square(Watch.Radius);
+		switch(GetCellCoverage(Entry.Cell, Watch.Center, RadiusSq))
+		{
+		case ECellCoverage::Inside:
+			bInside = true;
+			break;
+		case ECellCoverage::Partial:
+			bInside = FVector2D::DistSquared(
+						  FVector2D(Enemy->GetActorLocation()), Watch.Center)
+				<= RadiusSq;
+			break;
+		case ECellCoverage::Outside:
+			break;
+		}
+	}
+	SetInWatch(WatchId, Index, bInside);
+}
+
+void UMyEnemyRegistrySubsystem::RefreshInWatches(int32 Index)
+{
+	for(int32 WatchId = 0; WatchId < Watches.Num(); ++WatchId)
+	{
+		if(Watches[WatchId].bInUse)
+		{
+			RefreshInWatch(WatchId, Index);
+		}
+	}
+}
+
+void UMyEnemyRegistrySubsystem::SetInWatch(
+	int32 WatchId, int32 Index, bool bInside)
+{
+	FEnemyEntry &Entry = Entries[Index];
+	const uint32 Bit = 1u << WatchId;
+	if(((Entry.WatchMask & Bit) != 0) == bInside)
+	{
+		return;
+	}
+	Entry.WatchMask ^= Bit;
+
+	// Changing back before the next update cancels the first change
+	TMap<TWeakObjectPtr<AMyEnemy>, bool> &Changes = Watches[WatchId].Changes;
+	if(Changes.Remove(Entry.Enemy) == 0)
+	{
+		Changes.Add(Entry.Enemy, bInside);
+	}
+}
+
+TStatId UMyEnemyRegistrySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(
+		UMyEnemyRegistrySubsystem, STATGROUP_Tickables);
+}
+
+bool UMyEnemyRegistrySubsystem::DoesSupportWorldType(
+	const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
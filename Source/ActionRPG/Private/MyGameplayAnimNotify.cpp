@@ -0,0 +1,50 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyGameplayAnimNotify.h"
+
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "MyMontageTimelineSubsystem.h"
+
+void UMyGameplayAnimNotify::Notify(USkeletalMeshComponent *MeshComp,
+	UAnimSequenceBase *Animation,
+	const FAnimNotifyEventReference &EventReference)
+{
+	Super::Notify(MeshComp, Animation, EventReference);
+
+	if(!MeshComp)
+	{
+		return;
+	}
+
+	AActor *OwnerActor = MeshComp->GetOwner();
+	if(!OwnerActor || !OwnerActor->IsValidLowLevel())
+	{
+		return;
+	}
+
+	// The server timeline already fires notifies for montages it runs,
+	// including those on the sequences in their slot segments
+	UWorld *World = OwnerActor->GetWorld();
+	UMyMontageTimelineSubsystem *Timeline =
+		World ? World->GetSubsystem<UMyMontageTimelineSubsystem>() : nullptr;
+	if(Timeline && Timeline->IsRunningAnimation(OwnerActor, Animation))
+	{
+		return;
+	}
+
+	// Notifies placed on a sequence use the montage currently playing it
+	UAnimInstance *AnimInstance = MeshComp->GetAnimInstance();
+	const UAnimMontage *Montage = Cast<UAnimMontage>(Animation);
+	if(!Montage && AnimInstance)
+	{
+		Montage = AnimInstance->GetCurrentActiveMontage();
+	}
+	const float Position = Montage && AnimInstance
+							   ? AnimInstance->Montage_GetPosition(Montage)
+							   : 0.0f;
+
+	HandleNotify(OwnerActor, Montage, Position);
+}
@@ -0,0 +1,29 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyGameplayTags.h"
+
+namespace AbilityTags
+{
+UE_DEFINE_GAMEPLAY_TAG(Attack, "Ability.Attack");
+UE_DEFINE_GAMEPLAY_TAG(Dodge, "Ability.Dodge");
+UE_DEFINE_GAMEPLAY_TAG(Jump, "Ability.Jump");
+UE_DEFINE_GAMEPLAY_TAG(Sprint, "Ability.Sprint");
+} // namespace AbilityTags
+
+namespace DataTags
+{
+UE_DEFINE_GAMEPLAY_TAG(Damage, "Data.Damage");
+UE_DEFINE_GAMEPLAY_TAG(Health, "Data.Health");
+UE_DEFINE_GAMEPLAY_TAG(MaxHealth, "Data.MaxHealth");
+UE_DEFINE_GAMEPLAY_TAG(Stamina, "Data.Stamina");
+UE_DEFINE_GAMEPLAY_TAG(MaxStamina, "Data.MaxStamina");
+UE_DEFINE_GAMEPLAY_TAG(MaxWalkSpeed, "Data.MaxWalkSpeed");
+} // namespace DataTags
+
+namespace StateTags
+{
+UE_DEFINE_GAMEPLAY_TAG(Attacking, "State.Attacking");
+UE_DEFINE_GAMEPLAY_TAG(Dodging, "State.Dodging");
+UE_DEFINE_GAMEPLAY_TAG(Jumping, "State.Jumping");
+UE_DEFINE_GAMEPLAY_TAG(Sprinting, "State.Sprinting");
+} // namespace StateTags
@@ -0,0 +1,378 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyHitHistorySubsystem.h"
+
+#include "ActionRPG.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerState.h"
+#include "MyBaseCharacter.h"
+#include "MyGameConfig.h"
+#include "MyHurtboxComponent.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hit History Tracked Actors"),
+	STAT_HitHistoryTrackedActors, STATGROUP_ActionRPG);
+DECLARE_MEMORY_STAT(
+	TEXT("Hit History Memory"), STAT_HitHistoryMemory, STATGROUP_ActionRPG);
+DECLARE_CYCLE_STAT(TEXT("Rewind Hit Validation"), STAT_RewindHitValidation,
+	STATGROUP_ActionRPG);
+
+namespace
+{
+// Squared distance between segment PQ and the parallelogram swept by
+// segment AB moving by Motion, with the closest points on each
+double SweptSegmentDistSquared(const FVector &A, const FVector &B,
+	const FVector &Motion, const FVector &P, const FVector &Q,
+	FVector &OutOnSweep, FVector &OutOnSegment)
+{
+	// PQ passing through the face touches it (skipped when the face is
+	// flat, e.g. a sphere sweep or a blade moving along itself)
+	const FVector C = B + Motion;
+	const FVector D = A + Motion;
+	const bool bHasFace = FVector::CrossProduct(B - A, Motion).SizeSquared()
+						  > UE_KINDA_SMALL_NUMBER;
+	FVector Intersection;
+	FVector Normal;
+	if(bHasFace
+		&& (FMath::SegmentTriangleIntersection(
+				P, Q, A, B, C, Intersection, Normal)
+			|| FMath::SegmentTriangleIntersection(
+				P, Q, A, C, D, Intersection, Normal)))
+	{
+		OutOnSweep = Intersection;
+		OutOnSegment = Intersection;
+		return 0.0;
+	}
+
+	// Otherwise the closest points lie on one of its edges
+	const FVector Corners[4] = {A, B, C, D};
+	double BestDistSq = TNumericLimits<double>::Max();
+	for(int32 Index = 0; Index < 4; ++Index)
+	{
+		FVector OnEdge;
+		FVector OnSegment;
+		FMath::SegmentDistToSegmentSafe(Corners[Index],
+			Corners[(Index + 1) % 4], P, Q, OnEdge, OnSegment);
+		const double DistSq = FVector::DistSquared(OnEdge, OnSegment);
+		if(DistSq < BestDistSq)
+		{
+			BestDistSq = DistSq;
+			OutOnSweep = OnEdge;
+			OutOnSegment = OnSegment;
+		}
+	}
+	return BestDistSq;
+}
+} // namespace
+
+void UMyHitHistorySubsystem::Initialize(FSubsystemCollectionBase &Collection)
+{
+	Super::Initialize(Collection);
+
+	const FGameConfig &Config = FGameConfig::GetDefault();
+
+	// Size the ring buffer once so recording never allocates
+	SampleCapacity = FMath::Max(2, Config.HitHistorySampleCount);
+	const int32 BytesPerSample = sizeof(FVector3f) + sizeof(FVector2f);
+	MaxTracked = FMath::Max(1,
+		Config.HitHistoryMemoryBudgetKB * 1024
+			/ (SampleCapacity * BytesPerSample));
+
+	SampleTimes.SetNumZeroed(SampleCapacity);
+	Locations.SetNumZeroed(MaxTracked * SampleCapacity);
+	CapsuleSizes.SetNumZeroed(MaxTracked * SampleCapacity);
+	SlotCharacters.SetNum(MaxTracked);
+
+	// Pop() hands out the lowest slots first
+	FreeSlots.Reserve(MaxTracked);
+	for(int32 Slot = MaxTracked - 1; Slot >= 0; --Slot)
+	{
+		FreeSlots.Add(Slot);
+	}
+
+	SET_MEMORY_STAT(STAT_HitHistoryMemory,
+		Locations.GetAllocatedSize() + CapsuleSizes.GetAllocatedSize()
+			+ SampleTimes.GetAllocatedSize());
+}
+
+void UMyHitHistorySubsystem::Deinitialize()
+{
+	SET_MEMORY_STAT(STAT_HitHistoryMemory, 0);
+
+	Super::Deinitialize();
+}
+
+bool UMyHitHistorySubsystem::RegisterCharacter(AMyBaseCharacter *Character)
+{
+	if(!Character)
+	{
+		return false;
+	}
+
+	if(CharacterSlots.Contains(Character))
+	{
+		return true;
+	}
+
+	if(FreeSlots.Num() == 0)
+	{
+		return false; // Over budget; hits on it use current positions
+	}
+
+	const int32 Slot = FreeSlots.Pop(EAllowShrinking::No);
+	SlotCharacters[Slot] = Character;
+	CharacterSlots.Add(Character, Slot);
+	++NumTracked;
+
+	// Fill the whole history with the current pose so early rewinds are valid
+	for(int32 SampleIndex = 0; SampleIndex < SampleCapacity; ++SampleIndex)
+	{
+		WriteSample(Slot, SampleIndex);
+	}
+	return true;
+}
+
+void UMyHitHistorySubsystem::UnregisterCharacter(AMyBaseCharacter *Character)
+{
+	int32 Slot = INDEX_NONE;
+	if(!CharacterSlots.RemoveAndCopyValue(Character, Slot))
+	{
+		return;
+	}
+
+	SlotCharacters[Slot].Reset();
+	FreeSlots.Add(Slot);
+	--NumTracked;
+}
+
+bool UMyHitHistorySubsystem::IsTracked(const AActor *Actor) const
+{
+	const AMyBaseCharacter *Character = Cast<AMyBaseCharacter>(Actor);
+	return Character && CharacterSlots.Contains(Character);
+}
+
+double UMyHitHistorySubsystem::GetClientViewTime(const AActor *Attacker) const
+{
+	const APawn *Pawn = Cast<APawn>(Attacker);
+	if(!IsRecording() || !Pawn || Pawn->IsLocallyControlled())
+	{
+		return -1.0;
+	}
+
+	const APlayerState *PlayerState = Pawn->GetPlayerState();
+	if(!PlayerState)
+	{
+		return -1.0;
+	}
+
+	// The full round trip, not half of it: the client saw the targets half
+	// a round trip after the server moved them, and its swing reaches the
+	// server half a round trip after that. The server runs the damage
+	// notify on its own montage timeline from that moment.
+	const double Latency =
+		FMath::Min(PlayerState->GetPingInMilliseconds() * 0.001,
+			static_cast<double>(FGameConfig::GetDefault().MaxRewindTime));
+	return GetWorld()->GetTimeSeconds() - Latency;
+}
+
+AMyBaseCharacter *UMyHitHistorySubsystem::SweepRewound(const FVector &Start,
+	const FVector &End, const FQuat &Rotation, float Radius, float HalfHeight,
+	double Time, ECollisionChannel TargetChannel, const AActor *IgnoreActor,
+	FVector &OutImpactPoint) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_RewindHitValidation);
+
+	int32 Older = INDEX_NONE;
+	int32 Newer = INDEX_NONE;
+	float Alpha = 0.0f;
+	if(!FindSamples(Time, Older, Newer, Alpha))
+	{
+		return nullptr;
+	}
+
+	const float Tolerance = FGameConfig::GetDefault().RewindHitTolerance;
+
+	// The swept capsule's axis moving from Start to End covers a
+	// parallelogram; a sphere sweep is the degenerate case with no axis
+	const FVector SweepAxis = Rotation.GetUpVector()
+							  * FMath::Max(0.0f, HalfHeight - Radius);
+	const FVector Motion = End - Start;
+
+	AMyBaseCharacter *BestCharacter = nullptr;
+	double BestAlong = TNumericLimits<double>::Max();
+	for(int32 Slot = 0; Slot < MaxTracked; ++Slot)
+	{
+		AMyBaseCharacter *Character = SlotCharacters[Slot].Get();
+		if(!Character || Character == IgnoreActor || Character->bIsDead)
+		{
+			continue;
+		}
+
+		// Same filter as the live sweep: opposing, enabled hurtboxes only
+		const UMyHurtboxComponent *Hurtbox = Character->GetHurtboxComponent();
+		if(!Hurtbox || Hurtbox->GetCollisionObjectType() != TargetChannel
+			|| !Hurtbox->IsQueryCollisionEnabled())
+		{
+			continue;
+		}
+
+		const int32 OlderIndex = GetStorageIndex(Slot, Older);
+		const int32 NewerIndex = GetStorageIndex(Slot, Newer);
+		const FVector Location = FVector(FMath::Lerp(
+			Locations[OlderIndex], Locations[NewerIndex], Alpha));
+		const FVector2f Capsule = FMath::Lerp(
+			CapsuleSizes[OlderIndex], CapsuleSizes[NewerIndex], Alpha);
+
+		// Capsule as a segment between its hemisphere centers
+		const FVector Axis =
+			FVector::UpVector * FMath::Max(0.0f, Capsule.Y - Capsule.X);
+		FVector OnSweep;
+		FVector OnCapsule;
+		const double DistSq = SweptSegmentDistSquared(Start - SweepAxis,
+			Start + SweepAxis, Motion, Location + Axis, Location - Axis,
+			OnSweep, OnCapsule);
+
+		const double ReachSq =
+			FMath::Square(Radius + Capsule.X + Tolerance);
+		if(DistSq > ReachSq)
+		{
+			continue;
+		}
+
+		// Keep the first character along the sweep
+		const double Along = FVector::DotProduct(OnSweep - Start, Motion);
+		if(Along < BestAlong)
+		{
+			BestAlong = Along;
+			BestCharacter = Character;
+			OutImpactPoint = OnCapsule
+							 + (OnSweep - OnCapsule).GetSafeNormal()
+								   * Capsule.X;
+		}
+	}
+	return BestCharacter;
+}
+
+bool UMyHitHistorySubsystem::GetCapsuleAtTime(
+	const AMyBaseCharacter *Character, double Time, FVector &OutLocation,
+	float &OutRadius, float &OutHalfHeight) const
+{
+	const int32 *Slot = CharacterSlots.Find(Character);
+	int32 Older = INDEX_NONE;
+	int32 Newer = INDEX_NONE;
+	float Alpha = 0.0f;
+	if(!Slot || !FindSamples(Time, Older, Newer, Alpha))
+	{
+		return false;
+	}
+
+	const int32 OlderIndex = GetStorageIndex(*Slot, Older);
+	const int32 NewerIndex = GetStorageIndex(*Slot, Newer);
+	OutLocation = FVector(
+		FMath::Lerp(Locations[OlderIndex], Locations[NewerIndex], Alpha));
+	const FVector2f Capsule =
+		FMath::Lerp(CapsuleSizes[OlderIndex], CapsuleSizes[NewerIndex], Alpha);
+	OutRadius = Capsule.X;
+	OutHalfHeight = Capsule.Y;
+	return true;
+}
+
+bool UMyHitHistorySubsystem::IsRecording() const
+{
+	const UWorld *World = GetWorld();
+	if(!World)
+	{
+		return false;
+	}
+
+	const ENetMode NetMode = World->GetNetMode();
+	return NetMode == NM_DedicatedServer || NetMode == NM_ListenServer;
+}
+
+void UMyHitHistorySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SET_DWORD_STAT(STAT_HitHistoryTrackedActors, NumTracked);
+
+	if(IsRecording() && NumTracked > 0)
+	{
+		RecordPoses();
+	}
+}
+
+void UMyHitHistorySubsystem::RecordPoses()
+{
+	NewestSample = (NewestSample + 1) % SampleCapacity;
+	NumSamples = FMath::Min(NumSamples + 1, SampleCapacity);
+	SampleTimes[NewestSample] = GetWorld()->GetTimeSeconds();
+
+	for(int32 Slot = 0; Slot < MaxTracked; ++Slot)
+	{
+		if(SlotCharacters[Slot].IsValid())
+		{
+			WriteSample(Slot, NewestSample);
+		}
+	}
+}
+
+void UMyHitHistorySubsystem::WriteSample(int32 Slot, int32 SampleIndex)
+{
+	const AMyBaseCharacter *Character = SlotCharacters[Slot].Get();
+	const UCapsuleComponent *CapsuleComp = Character->GetCapsuleComponent();
+
+	const int32 Index = GetStorageIndex(Slot, SampleIndex);
+	Locations[Index] = FVector3f(Character->GetActorLocation());
+	CapsuleSizes[Index] = CapsuleComp
+							  ? FVector2f(CapsuleComp->GetScaledCapsuleRadius(),
+									CapsuleComp->GetScaledCapsuleHalfHeight())
+							  : FVector2f::ZeroVector;
+}
+
+bool UMyHitHistorySubsystem::FindSamples(
+	double Time, int32 &OutOlder, int32 &OutNewer, float &OutAlpha) const
+{
+	if(NumSamples == 0)
+	{
+		return false;
+	}
+
+	// Walk back from the newest sample; rewinds are short, so this stops
+	// after a few steps
+	int32 Newer = NewestSample;
+	for(int32 Step = 0; Step < NumSamples; ++Step)
+	{
+		const int32 Index =
+			(NewestSample - Step + SampleCapacity) % SampleCapacity;
+		if(SampleTimes[Index] <= Time)
+		{
+			const double Span = SampleTimes[Newer] - SampleTimes[Index];
+			OutOlder = Index;
+			OutNewer = Newer;
+			OutAlpha = Span > UE_SMALL_NUMBER
+						   ? static_cast<float>(
+								 (Time - SampleTimes[Index]) / Span)
+						   : 0.0f;
+			return true;
+		}
+		Newer = Index;
+	}
+
+	// Older than the history; clamp to the oldest sample
+	OutOlder = Newer;
+	OutNewer = Newer;
+	OutAlpha = 0.0f;
+	return true;
+}
+
+TStatId UMyHitHistorySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(
+		UMyHitHistorySubsystem, STATGROUP_Tickables);
+}
+
+bool UMyHitHistorySubsystem::DoesSupportWorldType(
+	const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,253 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyHitQuerySubsystem.h"
+
+#include "ActionRPG.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "MyAttackAbility.h"
+#include "MyCharacter.h"
+#include "MyCombatResolutionSubsystem.h"
+#include "MyDamageEffect.h"
+#include "MyEnemy.h"
+#include "MyGameConfig.h"
+#include "MyHitHistorySubsystem.h"
+#include "MyHurtboxComponent.h"
+#include "MyImpactFXSubsystem.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Attack Sweeps / Frame"),
+	STAT_AttackSweepsPerFrame, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Attack Sweeps Resolved"),
+	STAT_AttackSweepsResolved, STATGROUP_ActionRPG);
+DECLARE_CYCLE_STAT(TEXT("Resolve Attack Sweeps"), STAT_ResolveAttackSweeps,
+	STATGROUP_ActionRPG);
+
+void UMyHitQuerySubsystem::EnqueueAttackSweep(
+	const FMyAttackSweepRequest &Request)
+{
+	UWorld *World = GetWorld();
+	AActor *Attacker = Request.Attacker.Get();
+	if(!World || !Attacker)
+	{
+		return;
+	}
+
+	FCollisionQueryParams QueryParams;
+	QueryParams.AddIgnoredActor(Attacker); // Ignore self
+
+	// Issue immediately so the trace joins this frame's async batch; the
+	// result becomes available next frame
+	FInFlightSweep &Sweep = InFlightSweeps.AddDefaulted_GetRef();
+	Sweep.Request = Request;
+	Sweep.IssueFrame = GFrameCounter;
+	const FCollisionShape Shape =
+		Request.HalfHeight > Request.Radius
+			? FCollisionShape::MakeCapsule(Request.Radius, Request.HalfHeight)
+			: FCollisionShape::MakeSphere(Request.Radius);
+	Sweep.TraceHandle = World->AsyncSweepByObjectType(EAsyncTraceType::Multi,
+		Request.Start, Request.End, Request.Rotation,
+		FCollisionObjectQueryParams(Request.TargetChannel), Shape,
+		QueryParams);
+
+	++SweepsIssuedThisFrame;
+}
+
+void UMyHitQuerySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SET_DWORD_STAT(STAT_AttackSweepsPerFrame, SweepsIssuedThisFrame);
+	SweepsIssuedThisFrame = 0;
+
+	if(UWorld *World = GetWorld())
+	{
+		ResolveCompletedSweeps(World);
+
+		// Apply this frame's hits now rather than waiting for the combat
+		// subsystem's own tick
+		if(UMyCombatResolutionSubsystem *CombatResolution =
+				World->GetSubsystem<UMyCombatResolutionSubsystem>())
+		{
+			CombatResolution->FlushPendingDamage();
+		}
+	}
+}
+
+void UMyHitQuerySubsystem::ResolveCompletedSweeps(UWorld *World)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ResolveAttackSweeps);
+
+	int32 NumResolved = 0;
+	uint32 HitGroup = 0;
+	for(const FInFlightSweep &Sweep : InFlightSweeps)
+	{
+		// Sweeps are stored in issue order, so everything after the first
+		// sweep from this frame is still pending
+		if(Sweep.IssueFrame >= GFrameCounter)
+		{
+			break;
+		}
+		++NumResolved;
+
+		// A swing's group already hit; skip its remaining segments
+		const uint32 SweepGroup = Sweep.Request.SweepGroup;
+		if(!Sweep.Request.Attacker.IsValid()
+			|| (SweepGroup != 0 && SweepGroup == HitGroup))
+		{
+			continue;
+		}
+
+		FTraceDatum TraceData;
+		const bool bHasTraceData =
+			World->QueryTraceData(Sweep.TraceHandle, TraceData);
+		if(Sweep.Request.RewindTime >= 0.0)
+		{
+			if(ResolveRewoundSweep(
+				   Sweep, bHasTraceData ? &TraceData : nullptr, World))
+			{
+				HitGroup = SweepGroup;
+			}
+			continue;
+		}
+
+		if(!bHasTraceData)
+		{
+			// Result was dropped (e.g. the world skipped a frame)
+			continue;
+		}
+
+		// Only opposing hurtboxes are returned, nearest first
+		if(TraceData.OutHits.Num() > 0)
+		{
+			ApplyAttackHit(Sweep.Request, TraceData.OutHits[0]);
+			HitGroup = SweepGroup;
+		}
+	}
+
+	if(NumResolved > 0)
+	{
+		InFlightSweeps.RemoveAt(0, NumResolved, EAllowShrinking::No);
+	}
+
+	INC_DWORD_STAT_BY(STAT_AttackSweepsResolved, NumResolved);
+}
+
+bool UMyHitQuerySubsystem::ResolveRewoundSweep(const FInFlightSweep &Sweep,
+	const FTraceDatum *TraceData, UWorld *World) const
+{
+	const FMyAttackSweepRequest &Request = Sweep.Request;
+	UMyHitHistorySubsystem *HitHistory =
+		World->GetSubsystem<UMyHitHistorySubsystem>();
+	if(!HitHistory)
+	{
+		return false;
+	}
+
+	// Test against targets where the attacker's client saw them
+	FVector ImpactPoint;
+	if(AMyBaseCharacter *Target = HitHistory->SweepRewound(Request.Start,
+		   Request.End, Request.Rotation, Request.Radius, Request.HalfHeight,
+		   Request.RewindTime, Request.TargetChannel, Request.Attacker.Get(),
+		   ImpactPoint))
+	{
+		const FVector Normal = (Request.Start - ImpactPoint).GetSafeNormal();
+		ApplyAttackHit(Request,
+			FHitResult(Target, Target->GetHurtboxComponent(), ImpactPoint,
+				Normal));
+		return true;
+	}
+
+	// Characters over the history budget keep their current-pose hits
+	if(!TraceData)
+	{
+		return false;
+	}
+
+	for(const FHitResult &Hit : TraceData->OutHits)
+	{
+		if(!HitHistory->IsTracked(Hit.GetActor()))
+		{
+			ApplyAttackHit(Request, Hit);
+			return true;
+		}
+	}
+	return false;
+}
+
+void UMyHitQuerySubsystem::ApplyAttackHit(
+	const FMyAttackSweepRequest &Request, const FHitResult &Hit) const
+{
+	AActor *OwnerActor = Request.Attacker.Get();
+	AActor *HitActor = Hit.GetActor();
+	UWorld *World = GetWorld();
+
+	// Enemy doesn't use GAS for attacks
+	UMyAttackAbility *AttackAbility = nullptr;
+	if(AMyCharacter *MyChar = Cast<AMyCharacter>(OwnerActor))
+	{
+		AttackAbility = MyChar->GetActiveAttackAbility();
+	}
+
+	UMyCombatResolutionSubsystem *CombatResolution =
+		World ? World->GetSubsystem<UMyCombatResolutionSubsystem>() : nullptr;
+	if(!CombatResolution)
+	{
+		return;
+	}
+
+	FMyDamageEvent DamageEvent;
+	DamageEvent.DamageCauser = OwnerActor;
+	DamageEvent.DamageAmount = Request.DamageAmount;
+
+	// Queue damage; it is merged per target and applied once per frame
+	if(AMyEnemy *Enemy = Cast<AMyEnemy>(HitActor))
+	{
+		// For Enemy, use simple damage
+		DamageEvent.Target = Enemy;
+		CombatResolution->QueueDamage(DamageEvent);
+
+		// Apply knockback to prevent overlap
+		if(UCharacterMovementComponent *Movement =
+				Enemy->GetCharacterMovement())
+		{
+			FVector KnockbackDirection =
+				(Enemy->GetActorLocation() - OwnerActor->GetActorLocation())
+					.GetSafeNormal();
+			Movement->AddImpulse(
+				KnockbackDirection * FGameConfig::GetDefault().KnockbackForce,
+				true);
+		}
+	}
+	else if(AMyCharacter *Player = Cast<AMyCharacter>(HitActor))
+	{
+		// For Player, use GAS
+		DamageEvent.Target = Player;
+		DamageEvent.DamageEffectClass =
+			Request.DamageEffectClass ? Request.DamageEffectClass
+									  : TSubclassOf<UGameplayEffect>(
+											UMyDamageEffect::StaticClass());
+		CombatResolution->QueueDamage(DamageEvent);
+	}
+
+	// Spawn particle effect if from active attack ability
+	if(AttackAbility && AttackAbility->AttackParticleEffect)
+	{
+		if(UMyImpactFXSubsystem *ImpactFX =
+				World->GetSubsystem<UMyImpactFXSubsystem>())
+		{
+			ImpactFX->SpawnImpact(AttackAbility->AttackParticleEffect,
+				Hit.Location, FRotator::ZeroRotator);
+		}
+	}
+}
+
+TStatId UMyHitQuerySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMyHitQuerySubsystem, STATGROUP_Tickables);
+}
+
+bool UMyHitQuerySubsystem::DoesSupportWorldType(
+	const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
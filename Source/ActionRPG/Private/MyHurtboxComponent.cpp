@@ -0,0 +1,48 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyHurtboxComponent.h"
+
+#include "GameFramework/Character.h"
+#include "MyAbilityTypes.h"
+
+UMyHurtboxComponent::UMyHurtboxComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	// Only combat queries see hurtboxes
+	SetCollisionProfileName(CollisionProfiles::EnemyHurtbox);
+	SetGenerateOverlapEvents(false);
+	SetCanEverAffectNavigation(false);
+	CanCharacterStepUpOn = ECB_No;
+	bHiddenInGame = true;
+}
+
+void UMyHurtboxComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	const ACharacter *Character = Cast<ACharacter>(GetOwner());
+	const UCapsuleComponent *OwnerCapsule =
+		Character ? Character->GetCapsuleComponent() : nullptr;
+	if(bMatchOwnerCapsule && OwnerCapsule && OwnerCapsule != this)
+	{
+		SetCapsuleSize(OwnerCapsule->GetUnscaledCapsuleRadius(),
+			OwnerCapsule->GetUnscaledCapsuleHalfHeight(), false);
+	}
+}
+
+ECollisionChannel UMyHurtboxComponent::GetOpposingChannel() const
+{
+	return GetCollisionObjectType() == ECC_PlayerHurtbox ? ECC_EnemyHurtbox
+														 : ECC_PlayerHurtbox;
+}
+
+void UMyHurtboxComponent::DisableHurtbox()
+{
+	SetCollisionEnabled(ECollisionEnabled::NoCollision);
+}
+
+void UMyHurtboxComponent::EnableHurtbox()
+{
+	SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+}
@@ -0,0 +1,237 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyImpactFXSubsystem.h"
+
+#include "ActionRPG.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "MyGameConfig.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Impact FX Spawns"), STAT_ImpactFXSpawns, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Impact FX Reuses"), STAT_ImpactFXReuses, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(
+	TEXT("Impact FX Culls"), STAT_ImpactFXCulls, STATGROUP_ActionRPG);
+
+void UMyImpactFXSubsystem::Deinitialize()
+{
+	for(TPair<UNiagaraSystem *, FMyImpactFXPool> &Pair : Pools)
+	{
+		for(UNiagaraComponent *Component : Pair.Value.Components)
+		{
+			if(IsValid(Component))
+			{
+				Component->DestroyComponent();
+			}
+		}
+	}
+	Pools.Empty();
+	ActiveComponents.Empty();
+
+	Super::Deinitialize();
+}
+
+UNiagaraComponent *UMyImpactFXSubsystem::SpawnImpact(
+	UNiagaraSystem *System, const FVector &Location, const FRotator &Rotation)
+{
+	UWorld *World = GetWorld();
+	if(!System || !World || World->GetNetMode() == NM_DedicatedServer)
+	{
+		return nullptr;
+	}
+
+	const FGameConfig &Config = FGameConfig::GetDefault();
+
+	FVector ViewLocation = FVector::ZeroVector;
+	const bool bHasView = GetViewLocation(ViewLocation);
+	const double DistSq =
+		bHasView ? FVector::DistSquared(ViewLocation, Location) : 0.0;
+
+	// Distance cull
+	if(DistSq > FMath::Square(Config.ImpactFXCullDistance))
+	{
+		Counters.Culls++;
+		INC_DWORD_STAT(STAT_ImpactFXCulls);
+		return nullptr;
+	}
+
+	FMyImpactFXPool *Pool = Pools.Find(System);
+	if(!Pool)
+	{
+		PrewarmEffect(System, Config.ImpactFXPrewarmCount);
+		Pool = &Pools.FindOrAdd(System);
+	}
+
+	// Scan this effect's pool for an idle slot and its oldest active one
+	int32 IdleIndex = INDEX_NONE;
+	int32 OldestIndex = INDEX_NONE;
+	int32 NumActiveInPool = 0;
+	for(int32 Index = 0; Index < Pool->Components.Num(); ++Index)
+	{
+		UNiagaraComponent *Component = Pool->Components[Index];
+		if(!IsValid(Component))
+		{
+			continue;
+		}
+
+		if(!Component->IsActive())
+		{
+			IdleIndex = IdleIndex == INDEX_NONE ? Index : IdleIndex;
+			continue;
+		}
+
+		NumActiveInPool++;
+		if(OldestIndex == INDEX_NONE
+			|| Pool->ActivationTimes[Index]
+				   < Pool->ActivationTimes[OldestIndex])
+		{
+			OldestIndex = Index;
+		}
+	}
+
+	// Per-effect budget: restart the oldest instance of this effect
+	if(NumActiveInPool >= Config.ImpactFXPerEffectBudget
+		&& OldestIndex != INDEX_NONE)
+	{
+		Counters.Reuses++;
+		INC_DWORD_STAT(STAT_ImpactFXReuses);
+		return ActivatePooled(*Pool, OldestIndex, Location, Rotation);
+	}
+
+	// Global budget: free the oldest instance of any effect, unless this
+	// impact is farther away than everything already playing
+	if(GetNumActive() >= Config.ImpactFXGlobalBudget)
+	{
+		UNiagaraComponent *Oldest = nullptr;
+		double OldestTime = TNumericLimits<double>::Max();
+		double FarthestDistSq = 0.0;
+		for(TPair<UNiagaraSystem *, FMyImpactFXPool> &Pair : Pools)
+		{
+			const FMyImpactFXPool &OtherPool = Pair.Value;
+			for(int32 Index = 0; Index < OtherPool.Components.Num(); ++Index)
+			{
+				UNiagaraComponent *Component = OtherPool.Components[Index];
+				if(!IsValid(Component) || !Component->IsActive())
+				{
+					continue;
+				}
+
+				FarthestDistSq = FMath::Max(FarthestDistSq,
+					FVector::DistSquared(
+						ViewLocation, Component->GetComponentLocation()));
+				if(OtherPool.ActivationTimes[Index] < OldestTime)
+				{
+					OldestTime = OtherPool.ActivationTimes[Index];
+					Oldest = Component;
+				}
+			}
+		}
+
+		if(!Oldest || (bHasView && DistSq > FarthestDistSq))
+		{
+			Counters.Culls++;
+			INC_DWORD_STAT(STAT_ImpactFXCulls);
+			return nullptr;
+		}
+
+		// Components can't switch assets cheaply, so stop the oldest and
+		// play from this effect's own pool
+		const int32 OldestInPool = Pool->Components.Find(Oldest);
+		if(OldestInPool != INDEX_NONE)
+		{
+			Counters.Reuses++;
+			INC_DWORD_STAT(STAT_ImpactFXReuses);
+			return ActivatePooled(*Pool, OldestInPool, Location, Rotation);
+		}
+		Oldest->DeactivateImmediate();
+		ActiveComponents.Remove(Oldest);
+	}
+
+	// Growing the pool counts as a spawn, taking an idle slot as a reuse
+	if(IdleIndex == INDEX_NONE)
+	{
+		IdleIndex = AddPooledComponent(*Pool, System);
+	}
+	else
+	{
+		Counters.Reuses++;
+		INC_DWORD_STAT(STAT_ImpactFXReuses);
+	}
+	return ActivatePooled(*Pool, IdleIndex, Location, Rotation);
+}
+
+void UMyImpactFXSubsystem::PrewarmEffect(UNiagaraSystem *System, int32 Count)
+{
+	UWorld *World = GetWorld();
+	if(!System || !World || World->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	FMyImpactFXPool &Pool = Pools.FindOrAdd(System);
+	while(Pool.Components.Num() < Count)
+	{
+		AddPooledComponent(Pool, System);
+	}
+}
+
+int32 UMyImpactFXSubsystem::AddPooledComponent(
+	FMyImpactFXPool &Pool, UNiagaraSystem *System)
+{
+	UWorld *World = GetWorld();
+
+	UNiagaraComponent *Component = NewObject<UNiagaraComponent>(World);
+	Component->SetAutoActivate(false);
+	Component->SetAutoDestroy(false);
+	Component->SetAsset(System);
+	Component->OnSystemFinished.AddDynamic(
+		this, &UMyImpactFXSubsystem::OnImpactFinished);
+	Component->RegisterComponentWithWorld(World);
+
+	Counters.Spawns++;
+	INC_DWORD_STAT(STAT_ImpactFXSpawns);
+
+	Pool.ActivationTimes.Add(0.0);
+	return Pool.Components.Add(Component);
+}
+
+UNiagaraComponent *UMyImpactFXSubsystem::ActivatePooled(FMyImpactFXPool &Pool,
+	int32 Index, const FVector &Location, const FRotator &Rotation)
+{
+	UNiagaraComponent *Component = Pool.Components[Index];
+	Component->SetWorldLocationAndRotation(Location, Rotation);
+	Component->Activate(true); // Reset restarts a running instance
+	Pool.ActivationTimes[Index] = GetWorld()->GetTimeSeconds();
+
+	// After Activate, in case restarting reported the old run as finished
+	ActiveComponents.Add(Component);
+	return Component;
+}
+
+void UMyImpactFXSubsystem::OnImpactFinished(UNiagaraComponent *Component)
+{
+	ActiveComponents.Remove(Component);
+}
+
+bool UMyImpactFXSubsystem::GetViewLocation(FVector &OutLocation) const
+{
+	APlayerController *PlayerController =
+		GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr;
+	if(!PlayerController)
+	{
+		return false;
+	}
+
+	FRotator ViewRotation;
+	PlayerController->GetPlayerViewPoint(OutLocation, ViewRotation);
+	return true;
+}
+
+bool UMyImpactFXSubsystem::DoesSupportWorldType(
+	const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,234 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyMontageTimelineSubsystem.h"
+
+#include "ActionRPG.h"
+#include "Animation/AnimMontage.h"
+#include "Engine/World.h"
+#include "MyGameConfig.h"
+#include "MyGameplayAnimNotify.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Timeline Montages"),
+	STAT_TimelineMontages, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Timeline Notifies / Frame"),
+	STAT_TimelineNotifiesPerFrame, STATGROUP_ActionRPG);
+DECLARE_CYCLE_STAT(TEXT("Advance Montage Timelines"),
+	STAT_AdvanceMontageTimelines, STATGROUP_ActionRPG);
+
+bool UMyMontageTimelineSubsystem::IsTimelineActive() const
+{
+	const UWorld *World = GetWorld();
+	return World && World->GetNetMode() == NM_DedicatedServer
+		   && FGameConfig::GetDefault().bUseServerMontageTimeline;
+}
+
+void UMyMontageTimelineSubsystem::StartMontage(
+	AActor *Owner, UAnimMontage *Montage, float PlayRate)
+{
+	if(!Owner || !Montage || PlayRate * Montage->RateScale <= 0.0f
+		|| !IsTimelineActive())
+	{
+		return;
+	}
+
+	// One montage per owner, as with the default slot
+	const int32 Index = FindRun(Owner);
+	FMontageRun &Run =
+		Index != INDEX_NONE ? Runs[Index] : Runs.AddDefaulted_GetRef();
+	Run.Owner = Owner;
+	Run.Montage = Montage;
+	Run.Position = 0.0f;
+	Run.PlayRate = PlayRate * Montage->RateScale;
+}
+
+void UMyMontageTimelineSubsystem::StopMontage(
+	AActor *Owner, const UAnimMontage *Montage)
+{
+	const int32 Index = FindRun(Owner);
+	if(Index != INDEX_NONE
+		&& (!Montage || Runs[Index].Montage.Get() == Montage))
+	{
+		// Cleared rather than removed, so Tick can keep iterating
+		Runs[Index].Owner.Reset();
+	}
+}
+
+bool UMyMontageTimelineSubsystem::IsRunning(const AActor *Owner) const
+{
+	return FindRun(Owner) != INDEX_NONE;
+}
+
+bool UMyMontageTimelineSubsystem::IsRunningAnimation(
+	const AActor *Owner, const UAnimSequenceBase *Animation) const
+{
+	const int32 Index = FindRun(Owner);
+	const UAnimMontage *Montage =
+		Index != INDEX_NONE ? Runs[Index].Montage.Get() : nullptr;
+	if(!Montage || !Animation)
+	{
+		return false;
+	}
+
+	if(Montage == Animation)
+	{
+		return true;
+	}
+
+	for(const FSlotAnimationTrack &SlotTrack : Montage->SlotAnimTracks)
+	{
+		for(const FAnimSegment &Segment : SlotTrack.AnimTrack.AnimSegments)
+		{
+			if(Segment.GetAnimReference() == Animation)
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+void UMyMontageTimelineSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_AdvanceMontageTimelines);
+
+	int32 NumFired = 0;
+
+	// Runs started by a notify are appended and advance next frame
+	const int32 NumRuns = Runs.Num();
+	for(int32 Index = 0; Index < NumRuns; ++Index)
+	{
+		AActor *Owner = Runs[Index].Owner.Get();
+		UAnimMontage *Montage = Runs[Index].Montage.Get();
+		if(!Owner || !Montage)
+		{
+			Runs[Index].Owner.Reset();
+			continue;
+		}
+
+		const float From = Runs[Index].Position;
+		const float Length = Montage->GetPlayLength();
+		const float To = From + DeltaTime * Runs[Index].PlayRate;
+		const bool bFinished = To >= Length;
+		Runs[Index].Position = To;
+
+		// Include notifies placed exactly at the end of the montage
+		NumFired += FireNotifies(
+			Owner, Montage, From, bFinished ? Length + KINDA_SMALL_NUMBER : To);
+
+		// Firing may restart the run; only retire the one that finished
+		if(bFinished && Runs[Index].Montage.Get() == Montage
+			&& Runs[Index].Position == To)
+		{
+			Runs[Index].Owner.Reset();
+		}
+	}
+
+	Runs.RemoveAll(
+		[](const FMontageRun &Run) { return !Run.Owner.IsValid(); });
+
+	SET_DWORD_STAT(STAT_TimelineMontages, Runs.Num());
+	SET_DWORD_STAT(STAT_TimelineNotifiesPerFrame, NumFired);
+}
+
+int32 UMyMontageTimelineSubsystem::FindRun(const AActor *Owner) const
+{
+	return Runs.IndexOfByPredicate([Owner](const FMontageRun &Run)
+		{ return Owner && Run.Owner.Get() == Owner; });
+}
+
+int32 UMyMontageTimelineSubsystem::FireNotifies(
+	AActor *Owner, const UAnimMontage *Montage, float From, float To)
+{
+	int32 NumFired = 0;
+	for(const FAnimNotifyEvent &Event : Montage->Notifies)
+	{
+		const float TriggerTime = Event.GetTriggerTime();
+		if(TriggerTime < From || TriggerTime >= To)
+		{
+			continue;
+		}
+
+		if(UMyGameplayAnimNotify *Notify =
+				Cast<UMyGameplayAnimNotify>(Event.Notify))
+		{
+			Notify->HandleNotify(Owner, Montage, TriggerTime);
+			++NumFired;
+		}
+	}
+
+	// Notifies placed on the sequences inside the montage's slot segments
+	for(const FSlotAnimationTrack &SlotTrack : Montage->SlotAnimTracks)
+	{
+		for(const FAnimSegment &Segment : SlotTrack.AnimTrack.AnimSegments)
+		{
+			NumFired += FireSegmentNotifies(Owner, Montage, Segment, From, To);
+		}
+	}
+	return NumFired;
+}
+
+int32 UMyMontageTimelineSubsystem::FireSegmentNotifies(AActor *Owner,
+	const UAnimMontage *Montage, const FAnimSegment &Segment, float From,
+	float To)
+{
+	const UAnimSequenceBase *Anim = Segment.GetAnimReference();
+	const float Rate = FMath::Abs(Segment.AnimPlayRate);
+	const float AnimLength = Segment.AnimEndTime - Segment.AnimStartTime;
+	if(!Anim || Rate <= UE_SMALL_NUMBER || AnimLength <= 0.0f)
+	{
+		return 0;
+	}
+
+	// Skip segments outside the window before walking their notifies
+	const float LoopLength = AnimLength / Rate;
+	const float SegmentEnd =
+		Segment.StartPos + LoopLength * FMath::Max(1, Segment.LoopingCount);
+	if(SegmentEnd < From || Segment.StartPos >= To)
+	{
+		return 0;
+	}
+
+	int32 NumFired = 0;
+	for(const FAnimNotifyEvent &Event : Anim->Notifies)
+	{
+		UMyGameplayAnimNotify *Notify =
+			Cast<UMyGameplayAnimNotify>(Event.Notify);
+		const float AnimTime = Event.GetTriggerTime();
+		if(!Notify || AnimTime < Segment.AnimStartTime
+			|| AnimTime > Segment.AnimEndTime)
+		{
+			continue;
+		}
+
+		// Map sequence time to montage time; negative rates play backwards
+		const float Offset = Segment.AnimPlayRate < 0.0f
+								 ? Segment.AnimEndTime - AnimTime
+								 : AnimTime - Segment.AnimStartTime;
+		for(int32 Loop = 0; Loop < FMath::Max(1, Segment.LoopingCount);
+			++Loop)
+		{
+			const float TriggerTime =
+				Segment.StartPos + Loop * LoopLength + Offset / Rate;
+			if(TriggerTime >= From && TriggerTime < To)
+			{
+				Notify->HandleNotify(Owner, Montage, TriggerTime);
+				++NumFired;
+			}
+		}
+	}
+	return NumFired;
+}
+
+TStatId UMyMontageTimelineSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(
+		UMyMontageTimelineSubsystem, STATGROUP_Tickables);
+}
+
+bool UMyMontageTimelineSubsystem::DoesSupportWorldType(
+	const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
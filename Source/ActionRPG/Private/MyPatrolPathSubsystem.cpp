@@ -0,0 +1,239 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyPatrolPathSubsystem.h"
+
+#include "AIController.h"
+#include "ActionRPG.h"
+#include "Engine/World.h"
+#include "NavFilters/NavigationQueryFilter.h"
+#include "NavigationData.h"
+#include "NavigationSystem.h"
+#include "Navigation/PathFollowingComponent.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(
+	TEXT("Patrol Path Hits"), STAT_PatrolPathHits, STATGROUP_ActionRPG);
+DECLARE_DWORD_ACCUMULATOR_STAT(
+	TEXT("Patrol Path Misses"), STAT_PatrolPathMisses, STATGROUP_ActionRPG);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Patrol Path Hit Rate (%)"),
+	STAT_PatrolPathHitRate, STATGROUP_ActionRPG);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Patrol Path Time Saved (ms)"),
+	STAT_PatrolPathTimeSaved, STATGROUP_ActionRPG);
+
+void UMyPatrolPathSubsystem::OnWorldBeginPlay(UWorld &InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if(UNavigationSystemV1 *NavSys = UNavigationSystemV1::GetCurrent(&InWorld))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.AddDynamic(
+			this, &UMyPatrolPathSubsystem::OnNavigationGenerationFinished);
+	}
+}
+
+void UMyPatrolPathSubsystem::Deinitialize()
+{
+	if(UNavigationSystemV1 *NavSys =
+			UNavigationSystemV1::GetCurrent(GetWorld()))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.RemoveDynamic(
+			this, &UMyPatrolPathSubsystem::OnNavigationGenerationFinished);
+	}
+
+	Legs.Empty();
+	Routes.Empty();
+
+	Super::Deinitialize();
+}
+
+void UMyPatrolPathSubsystem::RegisterRoute(
+	const APawn *Pawn, const TArray<AActor *> &Points)
+{
+	UnregisterRoute(Pawn);
+
+	UNavigationSystemV1 *NavSys = UNavigationSystemV1::GetCurrent(GetWorld());
+	if(!Pawn || Points.Num() < 2 || !NavSys)
+	{
+		return;
+	}
+
+	const ANavigationData *NavData = NavSys->GetNavDataForProps(
+		Pawn->GetNavAgentPropertiesRef(), Pawn->GetActorLocation());
+	if(!NavData)
+	{
+		return;
+	}
+
+	TArray<FPathKey> &RouteLegs = Routes.Add(Pawn);
+	for(int32 Index = 0; Index < Points.Num(); ++Index)
+	{
+		const AActor *From = Points[Index];
+		const AActor *To = Points[(Index + 1) % Points.Num()];
+		if(From && To && From != To)
+		{
+			FindOrAddLeg(Pawn->GetNavAgentPropertiesRef(), *NavData, From, To)
+				.NumRoutes++;
+			RouteLegs.Emplace(From, To, NavData);
+		}
+	}
+}
+
+void UMyPatrolPathSubsystem::UnregisterRoute(const APawn *Pawn)
+{
+	TArray<FPathKey> RouteLegs;
+	if(!Routes.RemoveAndCopyValue(Pawn, RouteLegs))
+	{
+		return;
+	}
+
+	// Results of queries still in flight find no leg and are dropped
+	for(const FPathKey &Key : RouteLegs)
+	{
+		FPatrolLeg *Leg = Legs.Find(Key);
+		if(Leg && --Leg->NumRoutes <= 0)
+		{
+			Legs.Remove(Key);
+		}
+	}
+}
+
+EMyPatrolMoveResult UMyPatrolPathSubsystem::RequestPatrolMove(
+	AAIController *Controller, const AActor *From, const AActor *To)
+{
+	APawn *Pawn = Controller ? Controller->GetPawn() : nullptr;
+	UNavigationSystemV1 *NavSys = UNavigationSystemV1::GetCurrent(GetWorld());
+	if(!Pawn || !From || !To || !NavSys)
+	{
+		return EMyPatrolMoveResult::Pending;
+	}
+
+	const ANavigationData *NavData = NavSys->GetNavDataForProps(
+		Pawn->GetNavAgentPropertiesRef(), Pawn->GetActorLocation());
+	if(!NavData)
+	{
+		return EMyPatrolMoveResult::Pending;
+	}
+
+	const FPatrolLeg &Leg =
+		FindOrAddLeg(Pawn->GetNavAgentPropertiesRef(), *NavData, From, To);
+	if(Leg.bUnreachable)
+	{
+		return EMyPatrolMoveResult::Unreachable;
+	}
+
+	if(!Leg.Path.IsValid() || !Leg.Path->IsValid())
+	{
+		// Still pathfinding (or repathing after a local navmesh change)
+		Counters.Misses++;
+		INC_DWORD_STAT(STAT_PatrolPathMisses);
+		SET_FLOAT_STAT(STAT_PatrolPathHitRate, Counters.GetHitRate() * 100.0f);
+		return EMyPatrolMoveResult::Pending;
+	}
+
+	Counters.Hits++;
+	INC_DWORD_STAT(STAT_PatrolPathHits);
+	SET_FLOAT_STAT(STAT_PatrolPathHitRate, Counters.GetHitRate() * 100.0f);
+	SET_FLOAT_STAT(STAT_PatrolPathTimeSaved,
+		static_cast<float>(Counters.GetSecondsSaved() * 1000.0));
+
+	// Every enemy on this leg follows the same path object
+	FAIMoveRequest MoveRequest(To->GetActorLocation());
+	return Controller->RequestMove(MoveRequest, Leg.Path).IsValid()
+			   ? EMyPatrolMoveResult::Moving
+			   : EMyPatrolMoveResult::Pending;
+}
+
+void UMyPatrolPathSubsystem::InvalidatePaths()
+{
+	for(auto It = Legs.CreateIterator(); It; ++It)
+	{
+		FPatrolLeg &Leg = It->Value;
+		if(Leg.NumRoutes <= 0 || !Leg.From.IsValid() || !Leg.To.IsValid()
+			|| !Leg.NavData.IsValid())
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// Results of queries still in flight are dropped by their ID
+		Leg.Path.Reset();
+		Leg.bUnreachable = false;
+		QueryLeg(It->Key, Leg);
+	}
+}
+
+UMyPatrolPathSubsystem::FPatrolLeg &UMyPatrolPathSubsystem::FindOrAddLeg(
+	const FNavAgentProperties &AgentProperties,
+	const ANavigationData &NavData, const AActor *From, const AActor *To)
+{
+	const FPathKey Key(From, To, &NavData);
+	if(FPatrolLeg *Leg = Legs.Find(Key))
+	{
+		return *Leg;
+	}
+
+	FPatrolLeg &Leg = Legs.Add(Key);
+	Leg.From = From;
+	Leg.To = To;
+	Leg.NavData = &NavData;
+	Leg.AgentProperties = AgentProperties;
+	QueryLeg(Key, Leg);
+	return Leg;
+}
+
+void UMyPatrolPathSubsystem::QueryLeg(const FPathKey &Key, FPatrolLeg &Leg)
+{
+	UNavigationSystemV1 *NavSys = UNavigationSystemV1::GetCurrent(GetWorld());
+	const ANavigationData *NavData = Leg.NavData.Get();
+	const AActor *From = Leg.From.Get();
+	const AActor *To = Leg.To.Get();
+	if(!NavSys || !NavData || !From || !To)
+	{
+		Leg.QueryID = INVALID_NAVQUERYID;
+		return;
+	}
+
+	// Shared by every enemy on the route, so use the navmesh's own filter
+	FPathFindingQuery Query(this, *NavData, From->GetActorLocation(),
+		To->GetActorLocation(),
+		UNavigationQueryFilter::GetQueryFilter(*NavData, this, nullptr));
+
+	Leg.QueryStartTime = FPlatformTime::Seconds();
+	Leg.QueryID = NavSys->FindPathAsync(Leg.AgentProperties, Query,
+		FNavPathQueryDelegate::CreateUObject(
+			this, &UMyPatrolPathSubsystem::OnLegPathFound, Key));
+}
+
+void UMyPatrolPathSubsystem::OnLegPathFound(uint32 QueryID,
+	ENavigationQueryResult::Type Result, FNavPathSharedPtr Path, FPathKey Key)
+{
+	// Ignore queries replaced by a navmesh rebuild
+	FPatrolLeg *Leg = Legs.Find(Key);
+	if(!Leg || Leg->QueryID != QueryID)
+	{
+		return;
+	}
+	Leg->QueryID = INVALID_NAVQUERYID;
+
+	Counters.Queries++;
+	Counters.ComputeSeconds += FPlatformTime::Seconds() - Leg->QueryStartTime;
+
+	// Failures stay cached until the next rebuild
+	if(Result != ENavigationQueryResult::Success || !Path.IsValid())
+	{
+		Leg->bUnreachable = true;
+		return;
+	}
+	Leg->Path = Path;
+}
+
+void UMyPatrolPathSubsystem::OnNavigationGenerationFinished(
+	ANavigationData *NavData)
+{
+	InvalidatePaths();
+}
+
+bool UMyPatrolPathSubsystem::DoesSupportWorldType(
+	const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,252 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyPerceptionSubsystem.h"
+
+#include "ActionRPG.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "MyGameConfig.h"
+#include "MyPlayerRegistrySubsystem.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Perception Traces / Frame"),
+	STAT_PerceptionTracesPerFrame, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Perception Observers"),
+	STAT_PerceptionObservers, STATGROUP_ActionRPG);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Perception Avg Staleness (ms)"),
+	STAT_PerceptionStaleness, STATGROUP_ActionRPG);
+DECLARE_CYCLE_STAT(TEXT("Update Perception"), STAT_UpdatePerception,
+	STATGROUP_ActionRPG);
+
+FMyPerceptionResult UMyPerceptionSubsystem::GetPerception(
+	APawn *Observer, float DetectionRange)
+{
+	FMyPerceptionResult Result;
+	if(!Observer)
+	{
+		return Result;
+	}
+
+	int32 Index = INDEX_NONE;
+	if(const int32 *FoundIndex = ObserverIndices.Find(Observer))
+	{
+		Index = *FoundIndex;
+	}
+	else
+	{
+		// New observers are due for a trace on the next tick
+		Index = Observers.Num();
+		ObserverIndices.Add(Observer, Index);
+		FObserverState &NewState = Observers.AddDefaulted_GetRef();
+		NewState.Key = Observer;
+		NewState.Observer = Observer;
+	}
+
+	FObserverState &State = Observers[Index];
+	State.DetectionRange = DetectionRange;
+
+	const UMyPlayerRegistrySubsystem *PlayerRegistry =
+		GetWorld()->GetSubsystem<UMyPlayerRegistrySubsystem>();
+	Result.Player = State.Player.Get();
+	Result.bHasPlayers = PlayerRegistry && PlayerRegistry->GetNumPlayers() > 0;
+	Result.bInRange = State.bInRange;
+	Result.bHasLineOfSight = State.bHasLineOfSight;
+	return Result;
+}
+
+void UMyPerceptionSubsystem::UnregisterObserver(const APawn *Observer)
+{
+	if(const int32 *Index = ObserverIndices.Find(Observer))
+	{
+		RemoveObserverAt(*Index);
+	}
+}
+
+bool UMyPerceptionSubsystem::IsOccludedFrom(
+	const APawn *Observer, const ACharacter *Player) const
+{
+	const int32 *Index = ObserverIndices.Find(Observer);
+	if(!Index)
+	{
+		return false;
+	}
+
+	const FObserverState &State = Observers[*Index];
+	return State.Player.Get() == Player && State.bInRange
+		   && !State.bHasLineOfSight;
+}
+
+void UMyPerceptionSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_UpdatePerception);
+
+	UWorld *World = GetWorld();
+	if(!World)
+	{
+		return;
+	}
+
+	RemoveInvalidObservers();
+
+	const double Now = World->GetTimeSeconds();
+	CollectTraceResults(World, Now);
+	ScheduleTraces(World, Now);
+
+	SET_DWORD_STAT(STAT_PerceptionObservers, Observers.Num());
+}
+
+void UMyPerceptionSubsystem::CollectTraceResults(UWorld *World, double Now)
+{
+	for(FObserverState &State : Observers)
+	{
+		if(!State.PendingTrace.IsValid())
+		{
+			continue;
+		}
+
+		// Dropped results leave the observer due for another trace
+		FTraceDatum TraceData;
+		if(World->QueryTraceData(State.PendingTrace, TraceData))
+		{
+			const FHitResult *Hit =
+				TraceData.OutHits.Num() > 0 ? &TraceData.OutHits[0] : nullptr;
+			State.bHasLineOfSight = !Hit || !Hit->bBlockingHit
+									|| Hit->GetActor() == State.Player.Get();
+			State.LastTraceTime = Now;
+		}
+		State.PendingTrace = FTraceHandle();
+	}
+}
+
+void UMyPerceptionSubsystem::ScheduleTraces(UWorld *World, double Now)
+{
+	const UMyPlayerRegistrySubsystem *PlayerRegistry =
+		World->GetSubsystem<UMyPlayerRegistrySubsystem>();
+	const int32 NumObservers = Observers.Num();
+	if(!PlayerRegistry || NumObservers == 0)
+	{
+		SET_DWORD_STAT(STAT_PerceptionTracesPerFrame, 0);
+		SET_FLOAT_STAT(STAT_PerceptionStaleness, 0.0f);
+		return;
+	}
+
+	const FGameConfig &Config = FGameConfig::GetDefault();
+
+	// Range checks are cheap, so every observer is refreshed each frame
+	double TotalStaleness = 0.0;
+	int32 NumStale = 0;
+	for(FObserverState &State : Observers)
+	{
+		const FVector ObserverLocation = State.Observer->GetActorLocation();
+		ACharacter *NearestPlayer = PlayerRegistry->FindNearestPlayer(
+			ObserverLocation, State.DetectionRange);
+
+		// A new target invalidates line of sight to the old one
+		if(NearestPlayer != State.Player.Get())
+		{
+			State.Player = NearestPlayer;
+			State.bHasLineOfSight = false;
+			State.PendingTrace = FTraceHandle();
+		}
+
+		State.bInRange = NearestPlayer != nullptr;
+		State.DistanceToPlayer =
+			NearestPlayer ? FVector::Dist(ObserverLocation,
+								NearestPlayer->GetActorLocation())
+						  : 0.0f;
+
+		if(!State.bInRange)
+		{
+			// Trace again as soon as the player comes back in range
+			State.bHasLineOfSight = false;
+			State.LastTraceTime = -UE_BIG_NUMBER;
+		}
+		else if(State.LastTraceTime >= 0.0)
+		{
+			TotalStaleness += Now - State.LastTraceTime;
+			++NumStale;
+		}
+	}
+
+	// Round-robin under the budget; closer observers become due sooner
+	int32 NumIssued = 0;
+	for(int32 Step = 0; Step < NumObservers
+						&& NumIssued < Config.PerceptionTraceBudget;
+		++Step)
+	{
+		const int32 Index = (NextObserver + Step) % NumObservers;
+		FObserverState &State = Observers[Index];
+		if(!State.bInRange || State.PendingTrace.IsValid())
+		{
+			continue;
+		}
+
+		const float Closeness = State.DetectionRange > 0.0f
+									? State.DistanceToPlayer
+										  / State.DetectionRange
+									: 0.0f;
+		const float RefreshInterval =
+			FMath::Lerp(Config.PerceptionNearRefreshInterval,
+				Config.PerceptionFarRefreshInterval, Closeness);
+		if(Now - State.LastTraceTime < RefreshInterval)
+		{
+			continue;
+		}
+
+		APawn *Observer = State.Observer.Get();
+		FCollisionQueryParams QueryParams;
+		QueryParams.AddIgnoredActor(Observer); // Ignore self
+
+		State.PendingTrace = World->AsyncLineTraceByChannel(
+			EAsyncTraceType::Single, Observer->GetActorLocation(),
+			State.Player->GetActorLocation(), ECC_Visibility, QueryParams);
+		++NumIssued;
+		NextObserver = (Index + 1) % NumObservers;
+	}
+
+	SET_DWORD_STAT(STAT_PerceptionTracesPerFrame, NumIssued);
+	SET_FLOAT_STAT(STAT_PerceptionStaleness,
+		NumStale > 0 ? static_cast<float>(TotalStaleness / NumStale * 1000.0)
+					 : 0.0f);
+}
+
+void UMyPerceptionSubsystem::RemoveInvalidObservers()
+{
+	for(int32 Index = Observers.Num() - 1; Index >= 0; --Index)
+	{
+		if(!Observers[Index].Observer.IsValid())
+		{
+			RemoveObserverAt(Index);
+		}
+	}
+}
+
+void UMyPerceptionSubsystem::RemoveObserverAt(int32 Index)
+{
+	ObserverIndices.Remove(Observers[Index].Key);
+	Observers.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	// Fix the index of the observer moved into the hole
+	if(Observers.IsValidIndex(Index))
+	{
+		ObserverIndices.Add(Observers[Index].Key, Index);
+	}
+
+	if(NextObserver >= Observers.Num())
+	{
+		NextObserver = 0;
+	}
+}
+
+TStatId UMyPerceptionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(
+		UMyPerceptionSubsystem, STATGROUP_Tickables);
+}
+
+bool UMyPerceptionSubsystem::DoesSupportWorldType(
+	const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
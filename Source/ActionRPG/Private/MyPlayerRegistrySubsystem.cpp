@@ -0,0 +1,173 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyPlayerRegistrySubsystem.h"
+
+#include "ActionRPG.h"
+#include "GameFramework/Character.h"
+#include "MyBaseCharacter.h"
+#include "MyGameConfig.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Registered Players"),
+	STAT_RegisteredPlayers, STATGROUP_ActionRPG);
+
+void UMyPlayerRegistrySubsystem::Initialize(
+	FSubsystemCollectionBase &Collection)
+{
+	Super::Initialize(Collection);
+
+	Grid.SetCellSize(FGameConfig::GetDefault().PlayerRegistryCellSize);
+}
+
+void UMyPlayerRegistrySubsystem::RegisterPlayer(ACharacter *Player)
+{
+	if(!Player || EntryIndices.Contains(Player))
+	{
+		return;
+	}
+
+	const int32 Index = Entries.Num();
+	FPlayerEntry &Entry = Entries.AddDefaulted_GetRef();
+	Entry.Key = Player;
+	Entry.Player = Player;
+	Entry.Cell = Grid.GetCell(Player->GetActorLocation());
+	EntryIndices.Add(Player, Index);
+	Grid.Add(Index, Entry.Cell);
+}
+
+void UMyPlayerRegistrySubsystem::UnregisterPlayer(ACharacter *Player)
+{
+	if(const int32 *Index = EntryIndices.Find(Player))
+	{
+		RemoveEntryAt(*Index);
+	}
+}
+
+ACharacter *UMyPlayerRegistrySubsystem::FindNearestPlayer(
+	const FVector &Location, float Radius) const
+{
+	ACharacter *Nearest = nullptr;
+	double NearestDistSq = FMath::Square(static_cast<double>(Radius));
+	Grid.ForEachInRadius(Location, Radius, [&](int32 Index) {
+		ACharacter *Player = GetTargetInRange(Index, Location, NearestDistSq);
+		if(Player)
+		{
+			Nearest = Player;
+			NearestDistSq =
+				FVector::DistSquared(Player->GetActorLocation(), Location);
+		}
+	});
+	return Nearest;
+}
+
+void UMyPlayerRegistrySubsystem::GetPlayersInRadius(const FVector &Location,
+	float Radius, TArray<ACharacter *> &OutPlayers) const
+{
+	const double RadiusSq = FMath::Square(static_cast<double>(Radius));
+	Grid.ForEachInRadius(Location, Radius, [&](int32 Index) {
+		if(ACharacter *Player = GetTargetInRange(Index, Location, RadiusSq))
+		{
+			OutPlayers.Add(Player);
+		}
+	});
+}
+
+void UMyPlayerRegistrySubsystem::GetPlayers(
+	TArray<ACharacter *> &OutPlayers) const
+{
+	for(const FPlayerEntry &Entry : Entries)
+	{
+		if(ACharacter *Player = Entry.Player.Get())
+		{
+			OutPlayers.Add(Player);
+		}
+	}
+}
+
+ACharacter *UMyPlayerRegistrySubsystem::GetLocalPlayer() const
+{
+	for(const FPlayerEntry &Entry : Entries)
+	{
+		ACharacter *Player = Entry.Player.Get();
+		if(Player && Player->IsLocallyControlled())
+		{
+			return Player;
+		}
+	}
+	return nullptr;
+}
+
+void UMyPlayerRegistrySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Rehash players that crossed a cell boundary; drop destroyed ones
+	for(int32 Index = Entries.Num() - 1; Index >= 0; --Index)
+	{
+		const ACharacter *Player = Entries[Index].Player.Get();
+		if(!Player)
+		{
+			RemoveEntryAt(Index);
+			continue;
+		}
+
+		const FIntPoint Cell = Grid.GetCell(Player->GetActorLocation());
+		if(Cell != Entries[Index].Cell)
+		{
+			Grid.Remove(Index, Entries[Index].Cell);
+			Entries[Index].Cell = Cell;
+			Grid.Add(Index, Cell);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_RegisteredPlayers, Entries.Num());
+}
+
+void UMyPlayerRegistrySubsystem::RemoveEntryAt(int32 Index)
+{
+	const int32 LastIndex = Entries.Num() - 1;
+	Grid.Remove(Index, Entries[Index].Cell);
+	EntryIndices.Remove(Entries[Index].Key);
+
+	// Move the last entry into the hole and fix its cell and index
+	if(Index != LastIndex)
+	{
+		Grid.Remove(LastIndex, Entries[LastIndex].Cell);
+		Entries.Swap(Index, LastIndex);
+		Grid.Add(Index, Entries[Index].Cell);
+		EntryIndices.Add(Entries[Index].Key, Index);
+	}
+	Entries.RemoveAt(LastIndex, 1, EAllowShrinking::No);
+}
+
+ACharacter *UMyPlayerRegistrySubsystem::GetTargetInRange(
+	int32 Index, const FVector &Location, double RadiusSq) const
+{
+	ACharacter *Player = Entries[Index].Player.Get();
+	if(!Player)
+	{
+		return nullptr;
+	}
+
+	const AMyBaseCharacter *BaseCharacter = Cast<AMyBaseCharacter>(Player);
+	if(BaseCharacter && BaseCharacter->bIsDead)
+	{
+		return nullptr;
+	}
+
+	return FVector::DistSquared(Player->GetActorLocation(), Location)
+				   <= RadiusSq
+			   ? Player
+			   : nullptr;
+}
+
+TStatId UMyPlayerRegistrySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(
+		UMyPlayerRegistrySubsystem, STATGROUP_Tickables);
+}
+
+bool UMyPlayerRegistrySubsystem::DoesSupportWorldType(
+	const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,130 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyTargetScorer.h"
+
+#include "ActionRPG.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Target Candidates Scored"),
+	STAT_TargetCandidatesScored, STATGROUP_ActionRPG);
+DECLARE_CYCLE_STAT(
+	TEXT("Score Lock-On Targets"), STAT_ScoreTargets, STATGROUP_ActionRPG);
+
+void FMyTargetScorer::Reset(const FVector &InOrigin)
+{
+	Origin = InOrigin;
+	NumCandidates = 0;
+	OffsetX.Reset();
+	OffsetY.Reset();
+	OffsetZ.Reset();
+	Visibilities.Reset();
+	Threats.Reset();
+	Scores.Reset();
+}
+
+int32 FMyTargetScorer::Add(
+	const FVector &Location, bool bOccluded, float Threat)
+{
+	// Fill the padding lane if there is one, otherwise grow by a full
+	// vector of zeros
+	if(NumCandidates == OffsetX.Num())
+	{
+		OffsetX.AddZeroed(4);
+		OffsetY.AddZeroed(4);
+		OffsetZ.AddZeroed(4);
+		Visibilities.AddZeroed(4);
+		Threats.AddZeroed(4);
+		Scores.AddZeroed(4);
+	}
+
+	// Offsets keep float precision far from the world origin
+	const FVector3f Offset = FVector3f(Location - Origin);
+	const int32 Index = NumCandidates++;
+	OffsetX[Index] = Offset.X;
+	OffsetY[Index] = Offset.Y;
+	OffsetZ[Index] = Offset.Z;
+	Visibilities[Index] = bOccluded ? 0.0f : 1.0f;
+	Threats[Index] = Threat;
+	return Index;
+}
+
+void FMyTargetScorer::Score(const FVector &Forward, float Range,
+	const FMyTargetScoreWeights &Weights)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ScoreTargets);
+	SET_DWORD_STAT(STAT_TargetCandidatesScored, NumCandidates);
+
+	const FVector3f Forward3f = FVector3f(Forward);
+	const VectorRegister4Float ForwardX = VectorSetFloat1(Forward3f.X);
+	const VectorRegister4Float ForwardY = VectorSetFloat1(Forward3f.Y);
+	const VectorRegister4Float ForwardZ = VectorSetFloat1(Forward3f.Z);
+
+	// Distance term: W * (1 - Dist / Range) = W - Dist * (W / Range)
+	const VectorRegister4Float DistanceWeight =
+		VectorSetFloat1(Weights.Distance);
+	const VectorRegister4Float DistanceSlope =
+		VectorSetFloat1(Weights.Distance / FMath::Max(Range, 1.0f));
+	const VectorRegister4Float FacingWeight = VectorSetFloat1(Weights.Facing);
+	const VectorRegister4Float VisibilityWeight =
+		VectorSetFloat1(Weights.Visibility);
+	const VectorRegister4Float ThreatWeight = VectorSetFloat1(Weights.Threat);
+	const VectorRegister4Float MinDistSq =
+		VectorSetFloat1(UE_KINDA_SMALL_NUMBER);
+	const VectorRegister4Float Zero = VectorZeroFloat();
+
+	for(int32 Index = 0; Index < NumCandidates; Index += 4)
+	{
+		const VectorRegister4Float X = VectorLoad(&OffsetX[Index]);
+		const VectorRegister4Float Y = VectorLoad(&OffsetY[Index]);
+		const VectorRegister4Float Z = VectorLoad(&OffsetZ[Index]);
+
+		VectorRegister4Float DistSq = VectorMultiply(X, X);
+		DistSq = VectorMultiplyAdd(Y, Y, DistSq);
+		DistSq = VectorMultiplyAdd(Z, Z, DistSq);
+		DistSq = VectorMax(DistSq, MinDistSq);
+
+		const VectorRegister4Float InvDist = VectorReciprocalSqrt(DistSq);
+		const VectorRegister4Float Dist = VectorMultiply(DistSq, InvDist);
+
+		// Cosine between the view and the direction to the candidate;
+		// candidates behind the view add nothing
+		VectorRegister4Float Facing = VectorMultiply(X, ForwardX);
+		Facing = VectorMultiplyAdd(Y, ForwardY, Facing);
+		Facing = VectorMultiplyAdd(Z, ForwardZ, Facing);
+		Facing = VectorMax(VectorMultiply(Facing, InvDist), Zero);
+
+		VectorRegister4Float Score =
+			VectorNegateMultiplyAdd(Dist, DistanceSlope, DistanceWeight);
+		Score = VectorMultiplyAdd(Facing, FacingWeight, Score);
+		Score = VectorMultiplyAdd(
+			VectorLoad(&Visibilities[Index]), VisibilityWeight, Score);
+		Score = VectorMultiplyAdd(
+			VectorLoad(&Threats[Index]), ThreatWeight, Score);
+		VectorStore(Score, &Scores[Index]);
+	}
+}
+
+void FMyTargetScorer::SelectBest(int32 Count, TArray<int32> &OutIndices) const
+{
+	OutIndices.Reset();
+
+	TArray<int32, TInlineAllocator<64>> Heap;
+	Heap.Reserve(NumCandidates);
+	for(int32 Index = 0; Index < NumCandidates; ++Index)
+	{
+		Heap.Add(Index);
+	}
+
+	// Heapify is linear; popping only the best few keeps this
+	// O(N + K log N) instead of a full sort
+	const auto Better = [this](int32 A, int32 B) {
+		return Scores[A] > Scores[B];
+	};
+	Heap.Heapify(Better);
+
+	Count = FMath::Min(Count, NumCandidates);
+	while(OutIndices.Num() < Count)
+	{
+		OutIndices.Add(Heap.HeapTop());
+		Heap.HeapPopDiscard(Better, EAllowShrinking::No);
+	}
+}
@@ -0,0 +1,20 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyUniformGrid.h"
+
+void FMyUniformGrid::Add(int32 Index, const FIntPoint &Cell)
+{
+	Cells.FindOrAdd(Cell).Add(Index);
+}
+
+void FMyUniformGrid::Remove(int32 Index, const FIntPoint &Cell)
+{
+	if(FCellElements *CellElements = Cells.Find(Cell))
+	{
+		CellElements->RemoveSingleSwap(Index, EAllowShrinking::No);
+		if(CellElements->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
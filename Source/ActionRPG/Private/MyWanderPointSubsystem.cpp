@@ -0,0 +1,231 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyWanderPointSubsystem.h"
+
+#include "AIController.h"
+#include "Engine/World.h"
+#include "MyGameConfig.h"
+#include "NavFilters/NavigationQueryFilter.h"
+#include "NavigationData.h"
+#include "NavigationSystem.h"
+#include "Navigation/PathFollowingComponent.h"
+
+void UMyWanderPointSubsystem::OnWorldBeginPlay(UWorld &InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if(UNavigationSystemV1 *NavSys = UNavigationSystemV1::GetCurrent(&InWorld))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.AddDynamic(
+			this, &UMyWanderPointSubsystem::OnNavigationGenerationFinished);
+	}
+}
+
+void UMyWanderPointSubsystem::Deinitialize()
+{
+	if(UNavigationSystemV1 *NavSys =
+			UNavigationSystemV1::GetCurrent(GetWorld()))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.RemoveDynamic(
+			this, &UMyWanderPointSubsystem::OnNavigationGenerationFinished);
+	}
+
+	TilePoints.Empty();
+	PendingQueries.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UMyWanderPointSubsystem::RequestWanderMove(
+	AAIController *Controller, float Radius, FVector &OutGoal)
+{
+	UWorld *World = GetWorld();
+	APawn *Pawn = Controller ? Controller->GetPawn() : nullptr;
+	UNavigationSystemV1 *NavSys = UNavigationSystemV1::GetCurrent(World);
+	if(!Pawn || !NavSys)
+	{
+		return false;
+	}
+
+	const FVector Origin = Pawn->GetActorLocation();
+	const ANavigationData *NavData =
+		NavSys->GetNavDataForProps(Pawn->GetNavAgentPropertiesRef(), Origin);
+	if(!NavData)
+	{
+		return false;
+	}
+
+	// Gather cached points within Radius from the tiles the circle covers,
+	// in the pawn's height band and the ones above and below it
+	const FVector Feet = Pawn->GetNavAgentLocation();
+	const double MaxHeight = FGameConfig::GetDefault().WanderTileHeight;
+	const FIntVector MinTile =
+		GetTile(Feet - FVector(Radius, Radius, MaxHeight));
+	const FIntVector MaxTile =
+		GetTile(Feet + FVector(Radius, Radius, MaxHeight));
+	const double RadiusSq = FMath::Square(Radius);
+	TArray<FVector, TInlineAllocator<64>> Candidates;
+	for(int32 TileZ = MinTile.Z; TileZ <= MaxTile.Z; ++TileZ)
+	{
+		for(int32 TileY = MinTile.Y; TileY <= MaxTile.Y; ++TileY)
+		{
+			for(int32 TileX = MinTile.X; TileX <= MaxTile.X; ++TileX)
+			{
+				for(const FVector &Point :
+					GetTilePoints(FIntVector(TileX, TileY, TileZ)))
+				{
+					if(FVector::DistSquared2D(Point, Origin) <= RadiusSq
+						&& FMath::Abs(Point.Z - Feet.Z) <= MaxHeight)
+					{
+						Candidates.Add(Point);
+					}
+				}
+			}
+		}
+	}
+
+	if(Candidates.Num() == 0)
+	{
+		return false;
+	}
+
+	OutGoal = Candidates[FMath::RandHelper(Candidates.Num())];
+
+	// Unreachable points fail the query and the enemy picks again
+	const FSharedConstNavQueryFilter QueryFilter =
+		UNavigationQueryFilter::GetQueryFilter(*NavData, Controller,
+			Controller->GetDefaultNavigationFilterClass());
+	FPathFindingQuery Query(Controller, *NavData, Origin, OutGoal, QueryFilter);
+	const uint32 QueryID = NavSys->FindPathAsync(
+		Pawn->GetNavAgentPropertiesRef(), Query,
+		FNavPathQueryDelegate::CreateUObject(this,
+			&UMyWanderPointSubsystem::OnPathFound,
+			TWeakObjectPtr<AAIController>(Controller)));
+	if(QueryID == INVALID_NAVQUERYID)
+	{
+		return false;
+	}
+
+	PendingQueries.Add(Controller, QueryID);
+	return true;
+}
+
+bool UMyWanderPointSubsystem::IsMovePending(
+	const AAIController *Controller) const
+{
+	return PendingQueries.Contains(Controller);
+}
+
+void UMyWanderPointSubsystem::CancelWanderMove(const AAIController *Controller)
+{
+	PendingQueries.Remove(Controller);
+}
+
+void UMyWanderPointSubsystem::InvalidatePools()
+{
+	TilePoints.Reset();
+}
+
+const TArray<FVector> &UMyWanderPointSubsystem::GetTilePoints(
+	const FIntVector &Tile)
+{
+	if(const TArray<FVector> *Points = TilePoints.Find(Tile))
+	{
+		return *Points;
+	}
+
+	const FGameConfig &Config = FGameConfig::GetDefault();
+	TArray<FVector> &Points = TilePoints.Add(Tile);
+
+	UNavigationSystemV1 *NavSys = UNavigationSystemV1::GetCurrent(GetWorld());
+	if(!NavSys)
+	{
+		return Points;
+	}
+
+	// Find the navmesh anywhere in the tile's box first: random sampling
+	// only starts from a poly within the small default query extent
+	const FVector HalfExtent(Config.WanderTileSize * 0.5,
+		Config.WanderTileSize * 0.5, Config.WanderTileHeight * 0.5);
+	const FVector Center(Tile.X * Config.WanderTileSize,
+		Tile.Y * Config.WanderTileSize, Tile.Z * Config.WanderTileHeight);
+	FNavLocation Start;
+	if(!NavSys->ProjectPointToNavigation(
+		   Center + HalfExtent, Start, HalfExtent))
+	{
+		return Points; // No navmesh in this tile; cached as empty
+	}
+
+	// Sample once per tile; points outside it belong to other tiles
+	const float SampleRadius = Config.WanderTileSize * UE_HALF_SQRT_2;
+	Points.Reserve(Config.WanderPointsPerTile);
+	for(int32 Index = 0; Index < Config.WanderPointsPerTile; ++Index)
+	{
+		FNavLocation NavLocation;
+		if(NavSys->GetRandomPointInNavigableRadius(
+			   Start.Location, SampleRadius, NavLocation)
+			&& GetTile(NavLocation.Location) == Tile)
+		{
+			Points.Add(NavLocation.Location);
+		}
+	}
+	return Points;
+}
+
+FIntVector UMyWanderPointSubsystem::GetTile(const FVector &Location) const
+{
+	const FGameConfig &Config = FGameConfig::GetDefault();
+	return FIntVector(
+		FMath::FloorToInt32(Location.X / Config.WanderTileSize),
+		FMath::FloorToInt32(Location.Y / Config.WanderTileSize),
+		FMath::FloorToInt32(Location.Z / Config.WanderTileHeight));
+}
+
+void UMyWanderPointSubsystem::OnPathFound(uint32 QueryID,
+	ENavigationQueryResult::Type Result, FNavPathSharedPtr Path,
+	TWeakObjectPtr<AAIController> Controller)
+{
+	// Controller destroyed while the query ran: drop its entry by ID
+	if(!Controller.IsValid())
+	{
+		for(auto It = PendingQueries.CreateIterator(); It; ++It)
+		{
+			if(It->Value == QueryID)
+			{
+				It.RemoveCurrent();
+				break;
+			}
+		}
+		return;
+	}
+
+	// Ignore queries that were cancelled or replaced
+	const uint32 *PendingID = PendingQueries.Find(Controller.Get());
+	if(!PendingID || *PendingID != QueryID)
+	{
+		return;
+	}
+	PendingQueries.Remove(Controller.Get());
+
+	AAIController *AIController = Controller.Get();
+	if(!AIController || Result != ENavigationQueryResult::Success
+		|| !Path.IsValid())
+	{
+		return;
+	}
+
+	FAIMoveRequest MoveRequest(Path->GetEndLocation());
+	AIController->RequestMove(MoveRequest, Path);
+}
+
+void UMyWanderPointSubsystem::OnNavigationGenerationFinished(
+	ANavigationData *NavData)
+{
+	InvalidatePools();
+}
+
+bool UMyWanderPointSubsystem::DoesSupportWorldType(
+	const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
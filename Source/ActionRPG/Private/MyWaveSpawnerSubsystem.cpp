@@ -0,0 +1,264 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyWaveSpawnerSubsystem.h"
+
+#include "ActionRPG.h"
+#include "Engine/World.h"
+#include "MyEnemy.h"
+#include "MyEnemyPoolSubsystem.h"
+#include "MyGameConfig.h"
+#include "MyWaveDefinitionAsset.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Wave Spawn Steps / Frame"),
+	STAT_WaveSpawnSteps, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Wave Spawns Pending"),
+	STAT_WaveSpawnsPending, STATGROUP_ActionRPG);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Wave Spawn Frame Cost (ms)"),
+	STAT_WaveSpawnFrameCost, STATGROUP_ActionRPG);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Wave Spawn Worst Frame (ms)"),
+	STAT_WaveSpawnWorstFrame, STATGROUP_ActionRPG);
+
+bool UMyWaveSpawnerSubsystem::StartWaves(
+	UMyWaveDefinitionAsset *Waves, const TArray<AActor *> &SpawnPoints)
+{
+	StopWaves();
+
+	for(const AActor *SpawnPoint : SpawnPoints)
+	{
+		if(SpawnPoint)
+		{
+			SpawnTransforms.Add(SpawnPoint->GetActorTransform());
+		}
+	}
+
+	if(!Waves || Waves->Waves.Num() == 0 || SpawnTransforms.Num() == 0)
+	{
+		SpawnTransforms.Reset();
+		return false;
+	}
+
+	WaveAsset = Waves;
+	NextWaveTime =
+		GetWorld()->GetTimeSeconds() + WaveAsset->Waves[0].StartDelay;
+	WorstFrameSeconds = 0.0;
+	SET_FLOAT_STAT(STAT_WaveSpawnWorstFrame, 0.0f);
+	return true;
+}
+
+void UMyWaveSpawnerSubsystem::StopWaves()
+{
+	// Finish what was constructed so no half-spawned actor is left behind
+	for(const FPendingFinish &Finish : PendingFinishes)
+	{
+		if(AMyEnemy *Enemy = Finish.Enemy.Get())
+		{
+			Enemy->FinishSpawning(Finish.Transform);
+			PendingPossessions.Add(Enemy);
+		}
+	}
+	for(const TWeakObjectPtr<AMyEnemy> &Pending : PendingPossessions)
+	{
+		AMyEnemy *Enemy = Pending.Get();
+		if(Enemy && !Enemy->GetController())
+		{
+			Enemy->SpawnDefaultController();
+		}
+	}
+
+	WaveAsset = nullptr;
+	SpawnTransforms.Reset();
+	NextSpawnPoint = 0;
+	CurrentWave = INDEX_NONE;
+	NextWaveTime = -1.0;
+	PendingSpawns.Reset();
+	PendingFinishes.Reset();
+	PendingPossessions.Reset();
+	WaveEnemies.Reset();
+}
+
+void UMyWaveSpawnerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if(!WaveAsset)
+	{
+		return;
+	}
+
+	UpdateWaves();
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double Deadline =
+		StartTime + FGameConfig::GetDefault().WaveSpawnBudgetMs * 0.001;
+	const int32 NumSteps = ProcessPipeline(Deadline);
+	const double FrameSeconds = FPlatformTime::Seconds() - StartTime;
+
+	if(NumSteps > 0 && FrameSeconds > WorstFrameSeconds)
+	{
+		WorstFrameSeconds = FrameSeconds;
+		SET_FLOAT_STAT(STAT_WaveSpawnWorstFrame,
+			static_cast<float>(FrameSeconds * 1000.0));
+	}
+
+	SET_DWORD_STAT(STAT_WaveSpawnSteps, NumSteps);
+	SET_DWORD_STAT(STAT_WaveSpawnsPending,
+		PendingSpawns.Num() + PendingFinishes.Num()
+			+ PendingPossessions.Num());
+	SET_FLOAT_STAT(
+		STAT_WaveSpawnFrameCost, static_cast<float>(FrameSeconds * 1000.0));
+}
+
+void UMyWaveSpawnerSubsystem::UpdateWaves()
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+	const TArray<FMyWaveDefinition> &Waves = WaveAsset->Waves;
+
+	// Schedule the next wave once the current one is cleared
+	if(NextWaveTime < 0.0 && IsWaveCleared())
+	{
+		if(!Waves.IsValidIndex(CurrentWave + 1))
+		{
+			StopWaves(); // Last wave cleared
+			return;
+		}
+		NextWaveTime = Now + Waves[CurrentWave + 1].StartDelay;
+	}
+
+	if(NextWaveTime >= 0.0 && Now >= NextWaveTime)
+	{
+		NextWaveTime = -1.0;
+		BeginWave(CurrentWave + 1);
+	}
+}
+
+void UMyWaveSpawnerSubsystem::BeginWave(int32 WaveIndex)
+{
+	CurrentWave = WaveIndex;
+	WaveEnemies.Reset();
+
+	for(const FMyWaveEntry &Entry : WaveAsset->Waves[WaveIndex].Entries)
+	{
+		if(!Entry.EnemyClass)
+		{
+			continue;
+		}
+
+		for(int32 Index = 0; Index < Entry.Count; ++Index)
+		{
+			FPendingSpawn &Spawn = PendingSpawns.AddDefaulted_GetRef();
+			Spawn.EnemyClass = Entry.EnemyClass;
+			Spawn.Transform = SpawnTransforms[NextSpawnPoint];
+			NextSpawnPoint = (NextSpawnPoint + 1) % SpawnTransforms.Num();
+		}
+	}
+}
+
+bool UMyWaveSpawnerSubsystem::IsWaveCleared() const
+{
+	if(PendingSpawns.Num() > 0 || PendingFinishes.Num() > 0
+		|| PendingPossessions.Num() > 0)
+	{
+		return false;
+	}
+
+	for(const TWeakObjectPtr<AMyEnemy> &WaveEnemy : WaveEnemies)
+	{
+		const AMyEnemy *Enemy = WaveEnemy.Get();
+		if(Enemy && !Enemy->bIsDead && !Enemy->IsHidden())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+int32 UMyWaveSpawnerSubsystem::ProcessPipeline(double Deadline)
+{
+	// Each stage only takes what earlier frames queued, so a new enemy
+	// advances one stage per frame. Always take one step for progress.
+	int32 NumSteps = 0;
+	const auto HasBudget = [&NumSteps, Deadline]() {
+		return NumSteps == 0 || FPlatformTime::Seconds() < Deadline;
+	};
+
+	// Possess enemies that finished spawning on an earlier frame
+	int32 NumPossessed = 0;
+	const int32 NumToPossess = PendingPossessions.Num();
+	while(NumPossessed < NumToPossess && HasBudget())
+	{
+		AMyEnemy *Enemy = PendingPossessions[NumPossessed++].Get();
+		if(Enemy && !Enemy->GetController())
+		{
+			Enemy->SpawnDefaultController();
+		}
+		++NumSteps;
+	}
+	PendingPossessions.RemoveAt(0, NumPossessed, EAllowShrinking::No);
+
+	// Register components and run BeginPlay for constructed enemies
+	int32 NumFinished = 0;
+	const int32 NumToFinish = PendingFinishes.Num();
+	while(NumFinished < NumToFinish && HasBudget())
+	{
+		const FPendingFinish &Finish = PendingFinishes[NumFinished++];
+		if(AMyEnemy *Enemy = Finish.Enemy.Get())
+		{
+			Enemy->FinishSpawning(Finish.Transform);
+			PendingPossessions.Add(Enemy);
+			WaveEnemies.Add(Enemy);
+		}
+		++NumSteps;
+	}
+	PendingFinishes.RemoveAt(0, NumFinished, EAllowShrinking::No);
+
+	// Start new spawns
+	int32 NumConstructed = 0;
+	while(NumConstructed < PendingSpawns.Num() && HasBudget())
+	{
+		ConstructEnemy(PendingSpawns[NumConstructed++]);
+		++NumSteps;
+	}
+	PendingSpawns.RemoveAt(0, NumConstructed, EAllowShrinking::No);
+
+	return NumSteps;
+}
+
+void UMyWaveSpawnerSubsystem::ConstructEnemy(const FPendingSpawn &Spawn)
+{
+	UWorld *World = GetWorld();
+
+	// A pooled enemy is already initialized and possessed
+	if(UMyEnemyPoolSubsystem *Pool =
+			World->GetSubsystem<UMyEnemyPoolSubsystem>())
+	{
+		if(AMyEnemy *Enemy =
+				Pool->TryReuseEnemy(Spawn.EnemyClass, Spawn.Transform))
+		{
+			WaveEnemies.Add(Enemy);
+			return;
+		}
+	}
+
+	// Construction scripts only; components register in FinishSpawning
+	AMyEnemy *Enemy = World->SpawnActorDeferred<AMyEnemy>(Spawn.EnemyClass,
+		Spawn.Transform, nullptr, nullptr,
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+	if(Enemy)
+	{
+		FPendingFinish &Finish = PendingFinishes.AddDefaulted_GetRef();
+		Finish.Enemy = Enemy;
+		Finish.Transform = Spawn.Transform;
+	}
+}
+
+TStatId UMyWaveSpawnerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(
+		UMyWaveSpawnerSubsystem, STATGROUP_Tickables);
+}
+
+bool UMyWaveSpawnerSubsystem::DoesSupportWorldType(
+	const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
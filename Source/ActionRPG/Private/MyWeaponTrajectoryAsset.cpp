@@ -0,0 +1,175 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "MyWeaponTrajectoryAsset.h"
+
+#include "Animation/AnimMontage.h"
+#include "Animation/AnimSequence.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/SkeletalMeshSocket.h"
+#include "MyBaseCharacter.h"
+
+const FMyMontageTrajectory *UMyWeaponTrajectoryAsset::FindTrajectory(
+	const UAnimMontage *Montage) const
+{
+	if(!Montage)
+	{
+		return nullptr;
+	}
+
+	for(const FMyMontageTrajectory &Trajectory : Trajectories)
+	{
+		if(Trajectory.Montage == Montage && Trajectory.Samples.Num() > 1)
+		{
+			return &Trajectory;
+		}
+	}
+	return nullptr;
+}
+
+#if WITH_EDITOR
+void UMyWeaponTrajectoryAsset::BakeTrajectories()
+{
+	if(!SkeletalMesh || !SkeletalMesh->GetSkeleton())
+	{
+		return;
+	}
+
+	GatherSourceMontages();
+
+	for(FMyMontageTrajectory &Trajectory : Trajectories)
+	{
+		BakeTrajectory(Trajectory);
+	}
+
+	MarkPackageDirty();
+}
+
+void UMyWeaponTrajectoryAsset::GatherSourceMontages()
+{
+	const AMyBaseCharacter *Source =
+		SourceCharacterClass
+			? SourceCharacterClass->GetDefaultObject<AMyBaseCharacter>()
+			: nullptr;
+	if(!Source)
+	{
+		return;
+	}
+
+	TArray<UAnimMontage *> Montages;
+	Source->GetAttackMontages(Montages);
+
+	for(UAnimMontage *Montage : Montages)
+	{
+		const bool bHasEntry = Trajectories.ContainsByPredicate(
+			[Montage](const FMyMontageTrajectory &Trajectory)
+			{ return Trajectory.Montage == Montage; });
+		if(Montage && !bHasEntry)
+		{
+			FMyMontageTrajectory &Trajectory =
+				Trajectories.AddDefaulted_GetRef();
+			Trajectory.Montage = Montage;
+			Trajectory.StartSocket = DefaultStartSocket;
+			Trajectory.EndSocket = DefaultEndSocket;
+			Trajectory.Radius = DefaultRadius;
+		}
+	}
+}
+
+void UMyWeaponTrajectoryAsset::BakeTrajectory(
+	FMyMontageTrajectory &Trajectory) const
+{
+	Trajectory.Samples.Reset();
+	Trajectory.SampleInterval = 1.0f / FMath::Max(SampleRate, 1.0f);
+
+	if(!Trajectory.Montage)
+	{
+		return;
+	}
+
+	const int32 NumSamples =
+		FMath::FloorToInt32(
+			Trajectory.Montage->GetPlayLength() / Trajectory.SampleInterval)
+		+ 1;
+	Trajectory.Samples.Reserve(NumSamples);
+
+	for(int32 Index = 0; Index < NumSamples; ++Index)
+	{
+		const float Time = Index * Trajectory.SampleInterval;
+
+		FTransform StartTransform;
+		FTransform EndTransform;
+		if(!GetSocketTransform(
+			   Trajectory.Montage, Trajectory.StartSocket, Time, StartTransform)
+			|| !GetSocketTransform(
+				Trajectory.Montage, Trajectory.EndSocket, Time, EndTransform))
+		{
+			// Missing socket or animation; leave the entry unbaked
+			Trajectory.Samples.Reset();
+			return;
+		}
+
+		FMyTrajectorySample &Sample = Trajectory.Samples.AddDefaulted_GetRef();
+		Sample.Start = FVector3f(StartTransform.GetLocation());
+		Sample.End = FVector3f(EndTransform.GetLocation());
+	}
+}
+
+bool UMyWeaponTrajectoryAsset::GetSocketTransform(const UAnimMontage *Montage,
+	FName SocketName, float Time, FTransform &OutTransform) const
+{
+	// Sockets are a fixed offset from a bone
+	FName BoneName = SocketName;
+	FTransform SocketOffset = FTransform::Identity;
+	if(const USkeletalMeshSocket *Socket = SkeletalMesh->FindSocket(SocketName))
+	{
+		BoneName = Socket->BoneName;
+		SocketOffset = Socket->GetSocketLocalTransform();
+	}
+
+	const FReferenceSkeleton &RefSkeleton = SkeletalMesh->GetRefSkeleton();
+	const int32 BoneIndex = RefSkeleton.FindBoneIndex(BoneName);
+	if(BoneIndex == INDEX_NONE || Montage->SlotAnimTracks.Num() == 0)
+	{
+		return false;
+	}
+
+	// Map montage time onto the sequence playing in the first slot
+	const FAnimSegment *Segment =
+		Montage->SlotAnimTracks[0].AnimTrack.GetSegmentAtTime(Time);
+	const UAnimSequence *Sequence =
+		Segment ? Cast<UAnimSequence>(Segment->GetAnimReference()) : nullptr;
+	if(!Sequence)
+	{
+		return false;
+	}
+
+	const FAnimExtractContext Context(
+		static_cast<double>(Segment->ConvertTrackPosToAnimPos(Time)));
+	const USkeleton *Skeleton = SkeletalMesh->GetSkeleton();
+
+	// Compose local bone transforms up to the root
+	FTransform ComponentTransform = SocketOffset;
+	for(int32 Index = BoneIndex; Index != INDEX_NONE;
+		Index = RefSkeleton.GetParentIndex(Index))
+	{
+		FTransform LocalTransform = RefSkeleton.GetRefBonePose()[Index];
+
+		// Root motion moves the actor, not the mesh root
+		const bool bIsRootMotionRoot =
+			Index == 0 && Sequence->bEnableRootMotion;
+		const int32 SkeletonIndex =
+			Skeleton->GetSkeletonBoneIndexFromMeshBoneIndex(
+				SkeletalMesh, Index);
+		if(SkeletonIndex != INDEX_NONE && !bIsRootMotionRoot)
+		{
+			Sequence->GetBoneTransform(LocalTransform,
+				FSkeletonPoseBoneIndex(SkeletonIndex), Context, false);
+		}
+
+		ComponentTransform = ComponentTransform * LocalTransform;
+	}
+
+	OutTransform = ComponentTransform * MeshRelativeTransform;
+	return true;
+}
+#endif
@@ -0,0 +1,146 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AIController.h"
+#include "BTTask_AttackPlayer.h"
+#include "BTTask_FindPlayer.h"
+#include "BehaviorTree/BTCompositeNode.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "BehaviorTree/BehaviorTreeManager.h"
+#include "MyEnemy.h"
+#include "MyTestWorld.h"
+#include "UObject/UObjectIterator.h"
+
+namespace
+{
+// Number of task nodes of TaskClass under Node
+int32 CountTasks(const UBTCompositeNode *Node, const UClass *TaskClass)
+{
+	int32 Count = 0;
+	for(const FBTCompositeChild &Child : Node->Children)
+	{
+		if(Child.ChildComposite)
+		{
+			Count += CountTasks(Child.ChildComposite, TaskClass);
+		}
+		else if(Child.ChildTask && Child.ChildTask->IsA(TaskClass))
+		{
+			Count++;
+		}
+	}
+	return Count;
+}
+
+template<typename ObjectType>
+int32 CountLiveObjects()
+{
+	int32 Count = 0;
+	for(TObjectIterator<ObjectType> It; It; ++It)
+	{
+		if(!It->IsTemplate())
+		{
+			Count++;
+		}
+	}
+	return Count;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMyBehaviorTreeTaskMemoryTest,
+	"ActionRPG.AI.BehaviorTreeTaskMemory",
+	EAutomationTestFlags_ApplicationContextMask
+		| EAutomationTestFlags::ProductFilter)
+
+bool FMyBehaviorTreeTaskMemoryTest::RunTest(const FString &Parameters)
+{
+	UClass *EnemyClass = LoadClass<AMyEnemy>(
+		nullptr, TEXT("/Game/Core/AI/Enemy/BP_MyEnemy.BP_MyEnemy_C"));
+	if(!TestNotNull(TEXT("Enemy Blueprint"), EnemyClass))
+	{
+		return false;
+	}
+
+	FMyTestWorld TestWorld;
+	const int32 FindPlayerObjectsBefore =
+		CountLiveObjects<UBTTask_FindPlayer>();
+	const int32 AttackPlayerObjectsBefore =
+		CountLiveObjects<UBTTask_AttackPlayer>();
+
+	constexpr int32 NumControllers = 500;
+	UBehaviorTree *Tree = nullptr;
+	for(int32 Index = 0; Index < NumControllers; ++Index)
+	{
+		const FVector Location((Index % 25) * 300.0f, (Index / 25) * 300.0f,
+			100.0f);
+		AMyEnemy *Enemy = TestWorld.Spawn<AMyEnemy>(Location, EnemyClass);
+		if(!Enemy->GetController())
+		{
+			Enemy->SpawnDefaultController();
+		}
+
+		const AAIController *Controller =
+			Cast<AAIController>(Enemy->GetController());
+		const UBehaviorTreeComponent *BTComp = Controller
+			? Cast<UBehaviorTreeComponent>(Controller->GetBrainComponent())
+			: nullptr;
+		Tree = BTComp && !Tree ? BTComp->GetCurrentTree() : Tree;
+	}
+	if(!TestNotNull(TEXT("Enemies run a behavior tree"), Tree))
+	{
+		return false;
+	}
+
+	// Run the trees for a while so every task has executed
+	for(int32 Frame = 0; Frame < 30; ++Frame)
+	{
+		TestWorld.Tick();
+	}
+
+	// Non-instanced tasks share the tree's template node; instanced ones
+	// would add a UObject per controller
+	const int32 NumFindPlayerInstances =
+		CountLiveObjects<UBTTask_FindPlayer>() - FindPlayerObjectsBefore;
+	const int32 NumAttackPlayerInstances =
+		CountLiveObjects<UBTTask_AttackPlayer>() - AttackPlayerObjectsBefore;
+	TestTrue(TEXT("FindPlayer is not instanced per controller"),
+		NumFindPlayerInstances < NumControllers);
+	TestTrue(TEXT("AttackPlayer is not instanced per controller"),
+		NumAttackPlayerInstances < NumControllers);
+
+	UBehaviorTreeManager *BTManager =
+		UBehaviorTreeManager::GetCurrent(TestWorld.Get());
+	UBTCompositeNode *Root = nullptr;
+	uint16 InstanceMemorySize = 0;
+	if(!TestTrue(TEXT("Tree loads"),
+		   BTManager && BTManager->LoadTree(*Tree, Root, InstanceMemorySize)))
+	{
+		return false;
+	}
+
+	// Before: each task node was a UObject per controller instead of a
+	// memory block
+	const int32 NumFindPlayer =
+		CountTasks(Root, UBTTask_FindPlayer::StaticClass());
+	const int32 NumAttackPlayer =
+		CountTasks(Root, UBTTask_AttackPlayer::StaticClass());
+	const int32 InstancedBytes =
+		InstanceMemorySize
+		- NumFindPlayer * static_cast<int32>(sizeof(FBTFindPlayerMemory))
+		- NumAttackPlayer * static_cast<int32>(sizeof(FBTAttackPlayerMemory))
+		+ NumFindPlayer * UBTTask_FindPlayer::StaticClass()->GetStructureSize()
+		+ NumAttackPlayer
+			  * UBTTask_AttackPlayer::StaticClass()->GetStructureSize();
+
+	AddInfo(FString::Printf(
+		TEXT("%d controllers: BT memory %.1f KB (%d B each); instanced "
+			 "tasks would need about %.1f KB (%d B each) and %d UObjects"),
+		NumControllers, NumControllers * InstanceMemorySize / 1024.0f,
+		InstanceMemorySize, NumControllers * InstancedBytes / 1024.0f,
+		InstancedBytes, NumControllers * (NumFindPlayer + NumAttackPlayer)));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
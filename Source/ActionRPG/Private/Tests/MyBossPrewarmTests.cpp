@@ -0,0 +1,97 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/PlatformMemory.h"
+#include "MyBoss.h"
+#include "MyTestWorld.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+double GetUsedPhysicalMB()
+{
+	return FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+}
+
+double GetPeakUsedPhysicalMB()
+{
+	return FPlatformMemory::GetStats().PeakUsedPhysical / (1024.0 * 1024.0);
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMyBossPrewarmBenchmark,
+	"ActionRPG.AI.BossPrewarmBenchmark",
+	EAutomationTestFlags_ApplicationContextMask
+		| EAutomationTestFlags::PerfFilter)
+
+bool FMyBossPrewarmBenchmark::RunTest(const FString &Parameters)
+{
+	UClass *BossClass = LoadClass<AMyBoss>(
+		nullptr, TEXT("/Game/Core/AI/Boss/BP_MyBoss.BP_MyBoss_C"));
+	if(!TestNotNull(TEXT("Boss Blueprint"), BossClass))
+	{
+		return false;
+	}
+
+	FMyTestWorld TestWorld;
+
+	// The frame the boss wakes up in: activate and start the first attack
+	const auto MeasureActivationMs = [&](AMyBoss *Boss,
+										 bool bLoadSynchronously) {
+		const double StartTime = FPlatformTime::Seconds();
+		if(bLoadSynchronously)
+		{
+			TArray<UAnimMontage *> Montages;
+			Boss->GetAttackMontages(Montages);
+		}
+		Boss->bActivated = true;
+		const bool bAttacked = Boss->PlayAttack(EBossAttackType::Attack1);
+		TestWorld.Tick();
+		TestTrue(TEXT("Boss attacks on activation"), bAttacked);
+		return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	};
+
+	// Pre-warmed: the assets stream in before the player reaches the boss
+	AMyBoss *Boss = TestWorld.Spawn<AMyBoss>(FVector::ZeroVector, BossClass);
+	if(Boss->AreAssetsLoaded())
+	{
+		AddWarning(TEXT("Boss assets were already in memory; run in a fresh "
+						"process for cold numbers"));
+	}
+
+	const double MemoryBeforeMB = GetUsedPhysicalMB();
+	Boss->PrewarmAssets();
+	FlushAsyncLoading();
+	const double MemoryAfterMB = GetUsedPhysicalMB();
+	TestTrue(TEXT("Pre-warm loads the assets"), Boss->AreAssetsLoaded());
+	const double PrewarmedMs = MeasureActivationMs(Boss, false);
+
+	// Previous behaviour: nothing streamed, montages and the spear mesh
+	// load synchronously on the activation frame
+	TestWorld.Get()->DestroyActor(Boss);
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	AMyBoss *ColdBoss =
+		TestWorld.Spawn<AMyBoss>(FVector::ZeroVector, BossClass);
+	if(ColdBoss->AreAssetsLoaded())
+	{
+		AddWarning(TEXT("Boss assets are still referenced after garbage "
+						"collection; the synchronous frame is warm"));
+	}
+	const double SynchronousMs = MeasureActivationMs(ColdBoss, true);
+
+	AddInfo(FString::Printf(
+		TEXT("Activation frame: %.3f ms pre-warmed, %.3f ms loading "
+			 "synchronously"),
+		PrewarmedMs, SynchronousMs));
+	AddInfo(FString::Printf(
+		TEXT("Pre-warm brought in %.1f MB (%.1f MB -> %.1f MB used, "
+			 "%.1f MB peak)"),
+		MemoryAfterMB - MemoryBeforeMB, MemoryBeforeMB, MemoryAfterMB,
+		GetPeakUsedPhysicalMB()));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,164 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/MemoryBase.h"
+#include "MyAbilitySystemComponent.h"
+#include "MyAttributeSet.h"
+#include "MyDamageEffect.h"
+#include "MyGameplayTags.h"
+#include "MyTestWorld.h"
+
+namespace
+{
+// Forwards to the real allocator and counts game thread allocations
+class FMyCountingMalloc final : public FMalloc
+{
+public:
+	explicit FMyCountingMalloc(FMalloc *InInner) : Inner(InInner) {}
+
+	virtual void *Malloc(SIZE_T Size, uint32 Alignment) override
+	{
+		Record();
+		return Inner->Malloc(Size, Alignment);
+	}
+
+	virtual void *Realloc(
+		void *Original, SIZE_T Size, uint32 Alignment) override
+	{
+		Record();
+		return Inner->Realloc(Original, Size, Alignment);
+	}
+
+	virtual void Free(void *Original) override { Inner->Free(Original); }
+
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+	{
+		return Inner->QuantizeSize(Count, Alignment);
+	}
+
+	virtual bool GetAllocationSize(void *Original, SIZE_T &SizeOut) override
+	{
+		return Inner->GetAllocationSize(Original, SizeOut);
+	}
+
+	virtual bool IsInternallyThreadSafe() const override
+	{
+		return Inner->IsInternallyThreadSafe();
+	}
+
+	virtual const TCHAR *GetDescriptiveName() override
+	{
+		return TEXT("ActionRPG counting malloc");
+	}
+
+	// Allocations made by Function on the game thread
+	template<typename FunctionType>
+	static int32 Count(FunctionType &&Function)
+	{
+		FMyCountingMalloc Counting(GMalloc);
+		GMalloc = &Counting;
+		Function();
+		GMalloc = Counting.Inner;
+		return Counting.NumAllocations;
+	}
+
+private:
+	void Record()
+	{
+		if(IsInGameThread())
+		{
+			NumAllocations++;
+		}
+	}
+
+	FMalloc *Inner;
+	int32 NumAllocations = 0;
+};
+
+UMyAbilitySystemComponent *CreateAbilitySystem(AActor *Owner)
+{
+	UMyAbilitySystemComponent *ASC =
+		NewObject<UMyAbilitySystemComponent>(Owner);
+	ASC->RegisterComponent();
+	ASC->InitAbilityActorInfo(Owner, Owner);
+	return ASC;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMyDamageSpecCacheAllocationTest,
+	"ActionRPG.Combat.DamageSpecCacheAllocations",
+	EAutomationTestFlags_ApplicationContextMask
+		| EAutomationTestFlags::ProductFilter)
+
+bool FMyDamageSpecCacheAllocationTest::RunTest(const FString &Parameters)
+{
+#if PLATFORM_USES_FIXED_GMalloc_CLASS
+	AddWarning(TEXT("GMalloc is fixed on this platform; can't count"));
+	return true;
+#else
+	FMyTestWorld TestWorld;
+	AActor *Source = TestWorld.Spawn<AActor>();
+	AActor *Target = TestWorld.Spawn<AActor>();
+	UMyAbilitySystemComponent *SourceASC = CreateAbilitySystem(Source);
+	UMyAbilitySystemComponent *TargetASC = CreateAbilitySystem(Target);
+
+	// Enough health that no hit kills the target
+	TargetASC->AddAttributeSetSubobject(NewObject<UMyAttributeSet>(Target));
+	TargetASC->SetNumericAttributeBase(
+		UMyAttributeSet::GetMaxHealthAttribute(), 1.0e9f);
+	TargetASC->SetNumericAttributeBase(
+		UMyAttributeSet::GetHealthAttribute(), 1.0e9f);
+
+	const TSubclassOf<UGameplayEffect> EffectClass =
+		UMyDamageEffect::StaticClass();
+	constexpr int32 NumHits = 100;
+
+	// The first hit builds the spec and its SetByCaller entry
+	SourceASC->ApplyCachedDamageSpec(EffectClass, 1.0f, 1.0f, TargetASC);
+
+	// Our part of a steady-state hit: look up the spec, patch the damage
+	const int32 LookupAllocations = FMyCountingMalloc::Count([&]() {
+		for(int32 Hit = 0; Hit < NumHits; ++Hit)
+		{
+			FGameplayEffectSpecHandle Spec =
+				SourceASC->GetCachedDamageSpec(EffectClass, 1.0f);
+			Spec.Data->SetSetByCallerMagnitude(DataTags::Damage, -1.0f);
+		}
+	});
+	TestEqual(TEXT("Cached spec lookups allocate nothing"),
+		LookupAllocations, 0);
+
+	// Whole hits. Applying copies the spec and runs the attribute set's
+	// callbacks on either path, so the cache can only remove the cost of
+	// building the spec and its context.
+	const int32 CachedAllocations = FMyCountingMalloc::Count([&]() {
+		for(int32 Hit = 0; Hit < NumHits; ++Hit)
+		{
+			SourceASC->ApplyCachedDamageSpec(
+				EffectClass, 1.0f, 1.0f, TargetASC);
+		}
+	});
+	const int32 UncachedAllocations = FMyCountingMalloc::Count([&]() {
+		for(int32 Hit = 0; Hit < NumHits; ++Hit)
+		{
+			FGameplayEffectSpecHandle Spec = SourceASC->MakeOutgoingSpec(
+				EffectClass, 1.0f, SourceASC->MakeEffectContext());
+			Spec.Data->SetSetByCallerMagnitude(DataTags::Damage, -1.0f);
+			SourceASC->ApplyGameplayEffectSpecToTarget(*Spec.Data, TargetASC);
+		}
+	});
+
+	AddInfo(FString::Printf(
+		TEXT("Allocations per hit: cached %.1f, spec per hit %.1f"),
+		static_cast<float>(CachedAllocations) / NumHits,
+		static_cast<float>(UncachedAllocations) / NumHits));
+	TestTrue(TEXT("Cached hits allocate less than a spec per hit"),
+		CachedAllocations < UncachedAllocations);
+	return true;
+#endif
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
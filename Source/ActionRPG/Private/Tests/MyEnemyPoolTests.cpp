@@ -0,0 +1,148 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "GameFramework/Controller.h"
+#include "MyEnemy.h"
+#include "MyEnemyPoolSubsystem.h"
+#include "MyGameConfig.h"
+#include "MyTestWorld.h"
+#include "UObject/UObjectArray.h"
+
+namespace
+{
+int32 GetNumLiveObjects()
+{
+	return GUObjectArray.GetObjectArrayNumMinusAvailable();
+}
+
+// Totals over the waves after the first, which fills the pool
+struct FWaveTotals
+{
+	double SpawnSeconds = 0.0;
+	double GCSeconds = 0.0;
+	int32 ObjectsCreated = 0;
+	int32 ObjectsCollected = 0;
+};
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMyEnemyPoolWaveBenchmark,
+	"ActionRPG.AI.EnemyPoolWaveBenchmark",
+	EAutomationTestFlags_ApplicationContextMask
+		| EAutomationTestFlags::PerfFilter)
+
+bool FMyEnemyPoolWaveBenchmark::RunTest(const FString &Parameters)
+{
+	UClass *EnemyClass = LoadClass<AMyEnemy>(
+		nullptr, TEXT("/Game/Core/AI/Enemy/BP_MyEnemy.BP_MyEnemy_C"));
+	if(!TestNotNull(TEXT("Enemy Blueprint"), EnemyClass))
+	{
+		return false;
+	}
+
+	// A wave the pool can hold entirely, so nothing overflows
+	const int32 WaveSize = FGameConfig::GetDefault().EnemyPoolMaxPerClass;
+	constexpr int32 NumWaves = 6;
+	constexpr int32 NumFramesPerWave = 10;
+
+	// Spawn a wave with Acquire, fight for a few frames, then kill it with
+	// Release, collecting garbage as the level would between waves
+	const auto RunWaves = [&](const auto &Acquire, const auto &Release) {
+		FMyTestWorld TestWorld;
+		FWaveTotals Totals;
+		for(int32 Wave = 0; Wave < NumWaves; ++Wave)
+		{
+			TArray<AMyEnemy *> Enemies;
+			const int32 ObjectsBefore = GetNumLiveObjects();
+			const double StartTime = FPlatformTime::Seconds();
+			for(int32 Index = 0; Index < WaveSize; ++Index)
+			{
+				const FTransform Transform(
+					FVector(Index * 300.0f, Wave * 300.0f, 100.0f));
+				Enemies.Add(Acquire(TestWorld, Transform));
+			}
+			const double SpawnSeconds = FPlatformTime::Seconds() - StartTime;
+			const int32 ObjectsCreated = GetNumLiveObjects() - ObjectsBefore;
+
+			for(int32 Frame = 0; Frame < NumFramesPerWave; ++Frame)
+			{
+				TestWorld.Tick();
+			}
+			for(AMyEnemy *Enemy : Enemies)
+			{
+				Release(TestWorld, Enemy);
+			}
+			TestWorld.Tick();
+
+			const int32 ObjectsBeforeGC = GetNumLiveObjects();
+			const double GCStartTime = FPlatformTime::Seconds();
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+			if(Wave > 0)
+			{
+				Totals.SpawnSeconds += SpawnSeconds;
+				Totals.GCSeconds += FPlatformTime::Seconds() - GCStartTime;
+				Totals.ObjectsCreated += ObjectsCreated;
+				Totals.ObjectsCollected +=
+					ObjectsBeforeGC - GetNumLiveObjects();
+			}
+		}
+		return Totals;
+	};
+
+	// Previous behaviour: every wave spawns fresh enemies and destroys them
+	const FWaveTotals Destroyed = RunWaves(
+		[&](FMyTestWorld &TestWorld, const FTransform &Transform) {
+			AMyEnemy *Enemy = TestWorld.Spawn<AMyEnemy>(
+				Transform.GetLocation(), EnemyClass);
+			if(!Enemy->GetController())
+			{
+				Enemy->SpawnDefaultController();
+			}
+			return Enemy;
+		},
+		[](FMyTestWorld &TestWorld, AMyEnemy *Enemy) {
+			AController *Controller = Enemy->GetController();
+			Enemy->Destroy();
+			if(Controller)
+			{
+				Controller->Destroy();
+			}
+		});
+
+	int32 NumReuses = 0;
+	const FWaveTotals Pooled = RunWaves(
+		[&](FMyTestWorld &TestWorld, const FTransform &Transform) {
+			UMyEnemyPoolSubsystem *Pool =
+				TestWorld.Get()->GetSubsystem<UMyEnemyPoolSubsystem>();
+			AMyEnemy *Enemy = Pool->AcquireEnemy(EnemyClass, Transform);
+			NumReuses = Pool->GetCounters().Reuses;
+			return Enemy;
+		},
+		[](FMyTestWorld &TestWorld, AMyEnemy *Enemy) {
+			TestWorld.Get()->GetSubsystem<UMyEnemyPoolSubsystem>()
+				->ReleaseEnemy(Enemy);
+		});
+
+	// Only the first wave spawns; every later one reuses it
+	TestEqual(TEXT("Later waves reuse pooled enemies"), NumReuses,
+		WaveSize * (NumWaves - 1));
+
+	const auto Report = [&](const TCHAR *Name, const FWaveTotals &Totals) {
+		const int32 NumMeasuredWaves = NumWaves - 1;
+		AddInfo(FString::Printf(
+			TEXT("%s: %.3f ms per enemy spawned, %.1f objects created and "
+				 "%.1f collected per wave, %.3f ms GC per wave"),
+			Name,
+			Totals.SpawnSeconds * 1000.0 / (WaveSize * NumMeasuredWaves),
+			static_cast<float>(Totals.ObjectsCreated) / NumMeasuredWaves,
+			static_cast<float>(Totals.ObjectsCollected) / NumMeasuredWaves,
+			Totals.GCSeconds * 1000.0 / NumMeasuredWaves));
+	};
+	Report(TEXT("Pooled"), Pooled);
+	Report(TEXT("Spawn/destroy"), Destroyed);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
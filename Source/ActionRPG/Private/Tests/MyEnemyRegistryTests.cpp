@@ -0,0 +1,199 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Math/RandomStream.h"
+#include "MyEnemy.h"
+#include "MyEnemyRegistrySubsystem.h"
+#include "MyTestWorld.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMyEnemyRegistryRangeWatchTest,
+	"ActionRPG.AI.EnemyRegistry.RangeWatch",
+	EAutomationTestFlags_ApplicationContextMask
+		| EAutomationTestFlags::ProductFilter)
+
+bool FMyEnemyRegistryRangeWatchTest::RunTest(const FString &Parameters)
+{
+	FMyTestWorld TestWorld;
+	UMyEnemyRegistrySubsystem *Registry =
+		TestWorld.Get()->GetSubsystem<UMyEnemyRegistrySubsystem>();
+	if(!TestNotNull(TEXT("Enemy registry"), Registry))
+	{
+		return false;
+	}
+
+	AMyEnemy *Near = TestWorld.Spawn<AMyEnemy>(FVector(200.0f, 0.0f, 0.0f));
+	AMyEnemy *Mid = TestWorld.Spawn<AMyEnemy>(FVector(800.0f, 0.0f, 0.0f));
+	AMyEnemy *Far = TestWorld.Spawn<AMyEnemy>(FVector(3000.0f, 0.0f, 0.0f));
+
+	const int32 WatchId = Registry->AddRangeWatch(1000.0f);
+	if(!TestNotEqual(TEXT("Watch added"), WatchId, INDEX_NONE))
+	{
+		return false;
+	}
+
+	TArray<AMyEnemy *> Entered;
+	TArray<TWeakObjectPtr<AMyEnemy>> Exited;
+
+	// Updates append what changed, like the character's diff does
+	Registry->UpdateRangeWatch(WatchId, FVector::ZeroVector, Entered, Exited);
+	TestEqual(TEXT("Enemies in range enter on the first update"),
+		Entered.Num(), 2);
+	TestTrue(TEXT("Near and mid entered"),
+		Entered.Contains(Near) && Entered.Contains(Mid));
+	TestEqual(TEXT("Nothing exits on the first update"), Exited.Num(), 0);
+
+	// Enemies moving across cell boundaries are rehashed on tick
+	Mid->SetActorLocation(FVector(2000.0f, 0.0f, 0.0f));
+	Far->SetActorLocation(FVector(0.0f, 500.0f, 0.0f));
+	Registry->Tick(0.0f);
+	Entered.Reset();
+	Exited.Reset();
+	Registry->UpdateRangeWatch(WatchId, FVector::ZeroVector, Entered, Exited);
+	TestTrue(TEXT("Far entered"),
+		Entered.Num() == 1 && Entered.Contains(Far));
+	TestTrue(
+		TEXT("Mid exited"), Exited.Num() == 1 && Exited[0].Get() == Mid);
+
+	// Moving the watch itself
+	Entered.Reset();
+	Exited.Reset();
+	Registry->UpdateRangeWatch(
+		WatchId, FVector(2000.0f, 0.0f, 0.0f), Entered, Exited);
+	TestTrue(TEXT("Mid entered the moved watch"),
+		Entered.Num() == 1 && Entered.Contains(Mid));
+	TestEqual(TEXT("Near and far left the moved watch"), Exited.Num(), 2);
+
+	// Nothing changed, nothing reported
+	Entered.Reset();
+	Exited.Reset();
+	Registry->UpdateRangeWatch(
+		WatchId, FVector(2000.0f, 0.0f, 0.0f), Entered, Exited);
+	TestTrue(TEXT("No changes reported twice"),
+		Entered.Num() == 0 && Exited.Num() == 0);
+
+	// Unregistered enemies are reported as exits
+	TestWorld.Get()->DestroyActor(Mid);
+	Entered.Reset();
+	Exited.Reset();
+	Registry->UpdateRangeWatch(
+		WatchId, FVector(2000.0f, 0.0f, 0.0f), Entered, Exited);
+	TestEqual(TEXT("Destroyed enemy exited"), Exited.Num(), 1);
+
+	Registry->RemoveRangeWatch(WatchId);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMyEnemyRegistryBenchmark,
+	"ActionRPG.AI.EnemyRegistry.QueryBenchmark",
+	EAutomationTestFlags_ApplicationContextMask
+		| EAutomationTestFlags::PerfFilter)
+
+bool FMyEnemyRegistryBenchmark::RunTest(const FString &Parameters)
+{
+	// Enemies are spread over a fixed arena, so density grows with count
+	constexpr float ArenaHalfSize = 10000.0f;
+	constexpr float QueryRadius = 1500.0f;
+	constexpr float ConeHalfAngle = 45.0f;
+	constexpr int32 NearestCount = 5;
+	constexpr int32 NumQueries = 1000;
+
+	for(const int32 NumEnemies : {10, 100, 1000, 5000})
+	{
+		FMyTestWorld TestWorld;
+		const UMyEnemyRegistrySubsystem *Registry =
+			TestWorld.Get()->GetSubsystem<UMyEnemyRegistrySubsystem>();
+		if(!TestNotNull(TEXT("Enemy registry"), Registry))
+		{
+			return false;
+		}
+
+		FRandomStream Random(NumEnemies);
+		TArray<AMyEnemy *> Enemies;
+		for(int32 Index = 0; Index < NumEnemies; ++Index)
+		{
+			Enemies.Add(TestWorld.Spawn<AMyEnemy>(FVector(
+				Random.FRandRange(-ArenaHalfSize, ArenaHalfSize),
+				Random.FRandRange(-ArenaHalfSize, ArenaHalfSize), 0.0f)));
+		}
+		TestEqual(TEXT("Every enemy registered"), Registry->GetNumEnemies(),
+			NumEnemies);
+
+		TArray<FVector> Locations;
+		TArray<FVector> Directions;
+		for(int32 Query = 0; Query < NumQueries; ++Query)
+		{
+			Locations.Add(FVector(
+				Random.FRandRange(-ArenaHalfSize, ArenaHalfSize),
+				Random.FRandRange(-ArenaHalfSize, ArenaHalfSize), 0.0f));
+			Directions.Add(
+				FRotator(0.0f, Random.FRandRange(0.0f, 360.0f), 0.0f)
+					.Vector());
+		}
+
+		const auto MeasureUs = [&](const auto &RunQuery) {
+			TArray<AMyEnemy *> Result;
+			const double StartTime = FPlatformTime::Seconds();
+			for(int32 Query = 0; Query < NumQueries; ++Query)
+			{
+				Result.Reset();
+				RunQuery(Query, Result);
+			}
+			return (FPlatformTime::Seconds() - StartTime) * 1e6 / NumQueries;
+		};
+
+		// Previous approach: test every enemy
+		const double BruteForceUs =
+			MeasureUs([&](int32 Query, TArray<AMyEnemy *> &Result) {
+				for(AMyEnemy *Enemy : Enemies)
+				{
+					if(FVector::DistSquared(Enemy->GetActorLocation(),
+						   Locations[Query])
+						<= FMath::Square(QueryRadius))
+					{
+						Result.Add(Enemy);
+					}
+				}
+			});
+		const double RadiusUs =
+			MeasureUs([&](int32 Query, TArray<AMyEnemy *> &Result) {
+				Registry->GetEnemiesInRadius(
+					Locations[Query], QueryRadius, Result);
+			});
+		const double NearestUs =
+			MeasureUs([&](int32 Query, TArray<AMyEnemy *> &Result) {
+				Registry->FindNearestEnemies(
+					Locations[Query], QueryRadius, NearestCount, Result);
+			});
+		const double ConeUs =
+			MeasureUs([&](int32 Query, TArray<AMyEnemy *> &Result) {
+				Registry->GetEnemiesInCone(Locations[Query],
+					Directions[Query], ConeHalfAngle, QueryRadius, Result);
+			});
+
+		// The grid finds exactly what the linear scan finds
+		TArray<AMyEnemy *> Expected;
+		TArray<AMyEnemy *> Found;
+		for(AMyEnemy *Enemy : Enemies)
+		{
+			if(Enemy->GetActorLocation().Size() <= QueryRadius)
+			{
+				Expected.Add(Enemy);
+			}
+		}
+		Registry->GetEnemiesInRadius(FVector::ZeroVector, QueryRadius, Found);
+		TestEqual(TEXT("Radius query matches a linear scan"), Found.Num(),
+			Expected.Num());
+
+		AddInfo(FString::Printf(
+			TEXT("%d enemies: radius %.2f us (linear scan %.2f us), "
+				 "%d-nearest %.2f us, cone %.2f us"),
+			NumEnemies, RadiusUs, BruteForceUs, NearestCount, NearestUs,
+			ConeUs));
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
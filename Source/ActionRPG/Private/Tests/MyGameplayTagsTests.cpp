@@ -0,0 +1,86 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "GameplayTagsManager.h"
+#include "MyGameplayTags.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMyNativeGameplayTagsTest,
+	"ActionRPG.GameplayTags.NativeTags",
+	EAutomationTestFlags_ApplicationContextMask
+		| EAutomationTestFlags::ProductFilter)
+
+bool FMyNativeGameplayTagsTest::RunTest(const FString &Parameters)
+{
+	// Each native tag must resolve to the same tag as its string name
+	const TPair<FGameplayTag, const TCHAR *> Tags[] = {
+		{AbilityTags::Attack, TEXT("Ability.Attack")},
+		{AbilityTags::Dodge, TEXT("Ability.Dodge")},
+		{AbilityTags::Jump, TEXT("Ability.Jump")},
+		{AbilityTags::Sprint, TEXT("Ability.Sprint")},
+		{DataTags::Damage, TEXT("Data.Damage")},
+		{DataTags::Health, TEXT("Data.Health")},
+		{DataTags::MaxHealth, TEXT("Data.MaxHealth")},
+		{DataTags::Stamina, TEXT("Data.Stamina")},
+		{DataTags::MaxStamina, TEXT("Data.MaxStamina")},
+		{DataTags::MaxWalkSpeed, TEXT("Data.MaxWalkSpeed")},
+		{StateTags::Attacking, TEXT("State.Attacking")},
+		{StateTags::Dodging, TEXT("State.Dodging")},
+		{StateTags::Jumping, TEXT("State.Jumping")},
+		{StateTags::Sprinting, TEXT("State.Sprinting")},
+	};
+
+	for(const TPair<FGameplayTag, const TCHAR *> &Tag : Tags)
+	{
+		TestTrue(FString::Printf(TEXT("%s is valid"), Tag.Value),
+			Tag.Key.IsValid());
+		TestTrue(FString::Printf(TEXT("%s matches its name"), Tag.Value),
+			Tag.Key == FGameplayTag::RequestGameplayTag(FName(Tag.Value)));
+	}
+
+	TestTrue(TEXT("Tags replicate by fast index"),
+		UGameplayTagsManager::Get().ShouldUseFastReplication());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMyGameplayTagLookupBenchmark,
+	"ActionRPG.GameplayTags.LookupBenchmark",
+	EAutomationTestFlags_ApplicationContextMask
+		| EAutomationTestFlags::PerfFilter)
+
+bool FMyGameplayTagLookupBenchmark::RunTest(const FString &Parameters)
+{
+	constexpr int32 NumLookups = 100000;
+
+	// Hash the tags so the loops can't be optimized away
+	uint32 Hash = 0;
+
+	// Before: resolve the damage tag from its name on every hit
+	const double StringStart = FPlatformTime::Seconds();
+	for(int32 Index = 0; Index < NumLookups; ++Index)
+	{
+		Hash ^= GetTypeHash(
+			FGameplayTag::RequestGameplayTag(FName("Data.Damage")));
+	}
+	const double StringSeconds = FPlatformTime::Seconds() - StringStart;
+
+	// After: read the native tag
+	const double NativeStart = FPlatformTime::Seconds();
+	for(int32 Index = 0; Index < NumLookups; ++Index)
+	{
+		const FGameplayTag Tag = DataTags::Damage;
+		Hash ^= GetTypeHash(Tag) + Index;
+	}
+	const double NativeSeconds = FPlatformTime::Seconds() - NativeStart;
+
+	AddInfo(FString::Printf(
+		TEXT("%d lookups: RequestGameplayTag %.1f ns, native %.1f ns each "
+			 "(hash %u)"),
+		NumLookups, StringSeconds * 1e9 / NumLookups,
+		NativeSeconds * 1e9 / NumLookups, Hash));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
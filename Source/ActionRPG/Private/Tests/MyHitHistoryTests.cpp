@@ -0,0 +1,130 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "MyAbilityTypes.h"
+#include "MyEnemy.h"
+#include "MyGameConfig.h"
+#include "MyHitHistorySubsystem.h"
+#include "MyTestWorld.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMyHitHistoryRewindTest,
+	"ActionRPG.Combat.HitHistory.Rewind",
+	EAutomationTestFlags_ApplicationContextMask
+		| EAutomationTestFlags::ProductFilter)
+
+bool FMyHitHistoryRewindTest::RunTest(const FString &Parameters)
+{
+	FMyTestWorld TestWorld;
+	UMyHitHistorySubsystem *HitHistory =
+		TestWorld.Get()->GetSubsystem<UMyHitHistorySubsystem>();
+	if(!TestNotNull(TEXT("Hit history subsystem"), HitHistory))
+	{
+		return false;
+	}
+
+	// The ring buffer never grows past its memory budget
+	const FGameConfig &Config = FGameConfig::GetDefault();
+	const int32 BytesPerSample = sizeof(FVector3f) + sizeof(FVector2f);
+	TestTrue(TEXT("History fits the memory budget"),
+		HitHistory->GetMaxTracked() * Config.HitHistorySampleCount
+				* BytesPerSample
+			<= Config.HitHistoryMemoryBudgetKB * 1024);
+
+	// Enemies register on BeginPlay
+	AMyEnemy *Enemy = TestWorld.Spawn<AMyEnemy>(FVector::ZeroVector);
+	TestTrue(TEXT("Enemy is tracked"), HitHistory->IsTracked(Enemy));
+
+	const double StartTime = TestWorld.Get()->GetTimeSeconds();
+	HitHistory->RecordPoses();
+	TestWorld.Tick(0.1f);
+	Enemy->SetActorLocation(FVector(100.0f, 0.0f, 0.0f));
+	HitHistory->RecordPoses();
+
+	FVector Location;
+	float Radius = 0.0f;
+	float HalfHeight = 0.0f;
+	TestTrue(TEXT("Rewinds to the first sample"),
+		HitHistory->GetCapsuleAtTime(
+			Enemy, StartTime, Location, Radius, HalfHeight)
+			&& Location.Equals(FVector::ZeroVector, 1.0));
+	TestTrue(TEXT("Blends between samples"),
+		HitHistory->GetCapsuleAtTime(
+			Enemy, StartTime + 0.05, Location, Radius, HalfHeight)
+			&& Location.Equals(FVector(50.0f, 0.0f, 0.0f), 1.0));
+
+	// Characters past the budget aren't tracked
+	while(HitHistory->GetNumTracked() < HitHistory->GetMaxTracked())
+	{
+		TestWorld.Spawn<AMyEnemy>(FVector(0.0f, 0.0f, 1000.0f));
+	}
+	AMyEnemy *OverBudget =
+		TestWorld.Spawn<AMyEnemy>(FVector(0.0f, 0.0f, 1000.0f));
+	TestFalse(TEXT("Enemy over budget is not tracked"),
+		HitHistory->IsTracked(OverBudget));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMyHitHistoryRewindBenchmark,
+	"ActionRPG.Combat.HitHistory.RewindBenchmark",
+	EAutomationTestFlags_ApplicationContextMask
+		| EAutomationTestFlags::PerfFilter)
+
+bool FMyHitHistoryRewindBenchmark::RunTest(const FString &Parameters)
+{
+	FMyTestWorld TestWorld;
+	UMyHitHistorySubsystem *HitHistory =
+		TestWorld.Get()->GetSubsystem<UMyHitHistorySubsystem>();
+	if(!TestNotNull(TEXT("Hit history subsystem"), HitHistory))
+	{
+		return false;
+	}
+
+	constexpr int32 NumSweeps = 1000;
+	const int32 Counts[] = {10, 25, 50, 100};
+	FRandomStream Random(7);
+
+	for(const int32 Count : Counts)
+	{
+		const int32 NumActors = FMath::Min(Count, HitHistory->GetMaxTracked());
+		while(HitHistory->GetNumTracked() < NumActors)
+		{
+			TestWorld.Spawn<AMyEnemy>(FVector(Random.FRandRange(-2500, 2500),
+				Random.FRandRange(-2500, 2500), 100.0f));
+		}
+
+		// A few frames of history to rewind into
+		for(int32 Frame = 0; Frame < 8; ++Frame)
+		{
+			TestWorld.Tick();
+			HitHistory->RecordPoses();
+		}
+
+		// A blade swept across the middle of the crowd, rewound 50 ms
+		const double Time = TestWorld.Get()->GetTimeSeconds() - 0.05;
+		const FVector SweepStart(-100.0f, 0.0f, 100.0f);
+		const FVector SweepEnd(100.0f, 0.0f, 100.0f);
+		int32 NumHits = 0;
+		const double Start = FPlatformTime::Seconds();
+		for(int32 Sweep = 0; Sweep < NumSweeps; ++Sweep)
+		{
+			FVector ImpactPoint;
+			if(HitHistory->SweepRewound(SweepStart, SweepEnd, FQuat::Identity,
+				   10.0f, 60.0f, Time, ECC_EnemyHurtbox, nullptr, ImpactPoint))
+			{
+				NumHits++;
+			}
+		}
+		const double Seconds = FPlatformTime::Seconds() - Start;
+
+		AddInfo(FString::Printf(
+			TEXT("%d tracked actors: %.2f us per rewound sweep (%d hits)"),
+			HitHistory->GetNumTracked(), Seconds * 1e6 / NumSweeps,
+			NumHits));
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,109 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Animation/AnimInstance.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "MyEnemy.h"
+#include "MyMontageTimelineSubsystem.h"
+#include "MyTestWorld.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMyMontageTimelineBenchmark,
+	"ActionRPG.Animation.MontageTimelineBenchmark",
+	EAutomationTestFlags_ApplicationContextMask
+		| EAutomationTestFlags::PerfFilter)
+
+bool FMyMontageTimelineBenchmark::RunTest(const FString &Parameters)
+{
+	UClass *EnemyClass = LoadClass<AMyEnemy>(
+		nullptr, TEXT("/Game/Core/AI/Enemy/BP_MyEnemy.BP_MyEnemy_C"));
+	if(!TestNotNull(TEXT("Enemy Blueprint"), EnemyClass))
+	{
+		return false;
+	}
+
+	FMyTestWorld TestWorld;
+	UMyMontageTimelineSubsystem *Timeline =
+		TestWorld.Get()->GetSubsystem<UMyMontageTimelineSubsystem>();
+	const bool bTimelineActive = Timeline && Timeline->IsTimelineActive();
+	if(!bTimelineActive)
+	{
+		AddWarning(TEXT("The timeline only runs on dedicated servers; run "
+						"with -server -nullrhi to include its cost"));
+	}
+
+	constexpr int32 NumEnemies = 200;
+	TArray<AMyEnemy *> Enemies;
+	for(int32 Index = 0; Index < NumEnemies; ++Index)
+	{
+		const FVector Location((Index % 20) * 300.0f, (Index / 20) * 300.0f,
+			100.0f);
+		Enemies.Add(TestWorld.Spawn<AMyEnemy>(Location, EnemyClass));
+	}
+
+	// Every enemy attacks back to back, the worst case for notifies
+	const auto PlayAttacks = [&](bool bUseTimeline) {
+		for(AMyEnemy *Enemy : Enemies)
+		{
+			USkeletalMeshComponent *Mesh = Enemy->GetMesh();
+			UAnimInstance *AnimInstance =
+				Mesh ? Mesh->GetAnimInstance() : nullptr;
+			if(!AnimInstance || !Enemy->AttackMontage
+				|| AnimInstance->Montage_IsPlaying(Enemy->AttackMontage))
+			{
+				continue;
+			}
+
+			AnimInstance->Montage_Play(Enemy->AttackMontage);
+			if(bUseTimeline && bTimelineActive)
+			{
+				Timeline->StartMontage(Enemy, Enemy->AttackMontage);
+			}
+		}
+	};
+
+	const auto MeasureFrameMs = [&](EVisibilityBasedAnimTickOption Option,
+									bool bUseTimeline) {
+		for(AMyEnemy *Enemy : Enemies)
+		{
+			if(Enemy->GetMesh())
+			{
+				Enemy->GetMesh()->VisibilityBasedAnimTickOption = Option;
+			}
+		}
+
+		constexpr int32 NumWarmupFrames = 10;
+		constexpr int32 NumFrames = 120;
+		for(int32 Frame = 0; Frame < NumWarmupFrames; ++Frame)
+		{
+			PlayAttacks(bUseTimeline);
+			TestWorld.Tick();
+		}
+
+		const double Start = FPlatformTime::Seconds();
+		for(int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			PlayAttacks(bUseTimeline);
+			TestWorld.Tick();
+		}
+		return (FPlatformTime::Seconds() - Start) * 1000.0 / NumFrames;
+	};
+
+	// Without the timeline a server has to evaluate poses for notifies
+	const double FullPoseMs = MeasureFrameMs(
+		EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones, false);
+	const double TimelineMs = MeasureFrameMs(
+		EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered,
+		true);
+
+	AddInfo(FString::Printf(
+		TEXT("%d enemies: %.2f ms/frame with poses, %.2f ms/frame with "
+			 "the montage timeline%s"),
+		NumEnemies, FullPoseMs, TimelineMs,
+		bTimelineActive ? TEXT("") : TEXT(" (timeline inactive)")));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
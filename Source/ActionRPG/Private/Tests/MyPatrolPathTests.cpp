@@ -0,0 +1,74 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/World.h"
+#include "MyPatrolPathSubsystem.h"
+#include "Tests/AutomationCommon.h"
+
+namespace
+{
+// Patrolling enemies and a built navmesh live in the demo map
+const TCHAR *PatrolMapName =
+	TEXT("/Game/Maps/UndergroundSciFi/UndergroundSciFi_Demo");
+
+// Seconds the enemies patrol before the counters are read
+constexpr float PatrolSeconds = 30.0f;
+} // namespace
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(
+	FMyReportPatrolPathCountersCommand, FAutomationTestBase *, Test);
+
+bool FMyReportPatrolPathCountersCommand::Update()
+{
+	UWorld *World = AutomationCommon::GetAnyGameWorld();
+	const UMyPatrolPathSubsystem *PatrolPaths =
+		World ? World->GetSubsystem<UMyPatrolPathSubsystem>() : nullptr;
+	if(!Test->TestNotNull(TEXT("Patrol path subsystem"), PatrolPaths))
+	{
+		return true;
+	}
+
+	const FMyPatrolPathCounters &Counters = PatrolPaths->GetCounters();
+	if(Counters.Queries == 0)
+	{
+		Test->AddWarning(
+			TEXT("No patrol legs were pathfound; the map has no patrolling "
+				 "enemies or no navmesh"));
+		return true;
+	}
+
+	// Each leg is pathfound once however many moves walk it
+	Test->TestTrue(TEXT("Moves reuse cached legs"),
+		Counters.Hits + Counters.Misses >= Counters.Queries);
+
+	Test->AddInfo(FString::Printf(
+		TEXT("%d legs pathfound in %.3f ms total; %d hits, %d misses "
+			 "(%.1f%% hit rate); about %.3f ms of pathfinding saved"),
+		Counters.Queries, Counters.ComputeSeconds * 1000.0, Counters.Hits,
+		Counters.Misses, Counters.GetHitRate() * 100.0f,
+		Counters.GetSecondsSaved() * 1000.0));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMyPatrolPathCacheBenchmark,
+	"ActionRPG.AI.PatrolPathCacheBenchmark",
+	EAutomationTestFlags_ApplicationContextMask
+		| EAutomationTestFlags::PerfFilter)
+
+bool FMyPatrolPathCacheBenchmark::RunTest(const FString &Parameters)
+{
+	if(!AutomationOpenMap(PatrolMapName))
+	{
+		AddError(FString::Printf(TEXT("Failed to open %s"), PatrolMapName));
+		return false;
+	}
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(PatrolSeconds));
+	ADD_LATENT_AUTOMATION_COMMAND(FMyReportPatrolPathCountersCommand(this));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
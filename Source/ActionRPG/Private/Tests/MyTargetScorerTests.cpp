@@ -0,0 +1,195 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Math/RandomStream.h"
+#include "MyGameConfig.h"
+#include "MyTargetScorer.h"
+
+namespace
+{
+struct FTestCandidate
+{
+	FVector Location;
+	bool bOccluded;
+	float Threat;
+};
+
+TArray<FTestCandidate> MakeCandidates(
+	FRandomStream &Random, const FVector &Origin, float Range, int32 Num)
+{
+	TArray<FTestCandidate> Candidates;
+	for(int32 Index = 0; Index < Num; ++Index)
+	{
+		Candidates.Add(FTestCandidate{
+			Origin + Random.GetUnitVector() * Random.FRandRange(1.0f, Range),
+			Random.FRand() < 0.25f, Random.FRand()});
+	}
+	return Candidates;
+}
+
+// Scalar version of FMyTargetScorer::Score's formula
+float ScoreCandidate(const FTestCandidate &Candidate, const FVector &Origin,
+	const FVector &Forward, float Range, const FMyTargetScoreWeights &Weights)
+{
+	const FVector Offset = Candidate.Location - Origin;
+	const double Dist = FMath::Sqrt(FMath::Max(
+		Offset.SizeSquared(), static_cast<double>(UE_KINDA_SMALL_NUMBER)));
+	const double Facing = FMath::Max((Offset / Dist) | Forward, 0.0);
+	return static_cast<float>(
+		Weights.Distance * (1.0 - Dist / FMath::Max(Range, 1.0f))
+		+ Weights.Facing * Facing
+		+ Weights.Visibility * (Candidate.bOccluded ? 0.0 : 1.0)
+		+ Weights.Threat * Candidate.Threat);
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMyTargetScorerTest,
+	"ActionRPG.Combat.TargetScorer",
+	EAutomationTestFlags_ApplicationContextMask
+		| EAutomationTestFlags::ProductFilter)
+
+bool FMyTargetScorerTest::RunTest(const FString &Parameters)
+{
+	const FVector Origin(100000.0f, -50000.0f, 200.0f);
+	const FVector Forward = FVector(1.0f, 1.0f, 0.0f).GetSafeNormal();
+	constexpr float Range = 2000.0f;
+	const FMyTargetScoreWeights Weights;
+
+	// Counts around the vector width exercise the padding lanes
+	FRandomStream Random(7);
+	for(const int32 Num : {0, 1, 3, 4, 5, 37})
+	{
+		const TArray<FTestCandidate> Candidates =
+			MakeCandidates(Random, Origin, Range, Num);
+
+		FMyTargetScorer Scorer;
+		Scorer.Reset(Origin);
+		for(const FTestCandidate &Candidate : Candidates)
+		{
+			Scorer.Add(Candidate.Location, Candidate.bOccluded,
+				Candidate.Threat);
+		}
+		TestEqual(TEXT("Candidate count"), Scorer.Num(), Num);
+		Scorer.Score(Forward, Range, Weights);
+
+		TArray<float> Expected;
+		for(int32 Index = 0; Index < Num; ++Index)
+		{
+			Expected.Add(ScoreCandidate(
+				Candidates[Index], Origin, Forward, Range, Weights));
+			TestEqual(FString::Printf(TEXT("Score %d of %d"), Index, Num),
+				Scorer.GetScore(Index), Expected[Index], 1e-3f);
+		}
+
+		// The best few match a full sort of the reference scores
+		const int32 Count = 4;
+		TArray<int32> Best;
+		Scorer.SelectBest(Count, Best);
+		Expected.Sort(TGreater<float>());
+		TestEqual(TEXT("Selects at most Count candidates"), Best.Num(),
+			FMath::Min(Count, Num));
+		for(int32 Rank = 0; Rank < Best.Num(); ++Rank)
+		{
+			TestEqual(FString::Printf(TEXT("Rank %d of %d"), Rank, Num),
+				Scorer.GetScore(Best[Rank]), Expected[Rank], 1e-3f);
+		}
+	}
+
+	// Reset drops every candidate
+	FMyTargetScorer Scorer;
+	Scorer.Reset(Origin);
+	Scorer.Add(Origin + FVector(100.0f, 0.0f, 0.0f), false, 0.0f);
+	Scorer.Reset(Origin);
+	TArray<int32> Best;
+	Scorer.SelectBest(4, Best);
+	TestTrue(TEXT("Reset drops candidates"),
+		Scorer.Num() == 0 && Best.Num() == 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMyTargetScorerBenchmark,
+	"ActionRPG.Combat.TargetScorerBenchmark",
+	EAutomationTestFlags_ApplicationContextMask
+		| EAutomationTestFlags::PerfFilter)
+
+bool FMyTargetScorerBenchmark::RunTest(const FString &Parameters)
+{
+	const FVector Origin(1000.0f, 2000.0f, 100.0f);
+	const FVector Forward = FVector::ForwardVector;
+	constexpr float Range = 2000.0f;
+	const FMyTargetScoreWeights Weights;
+	const int32 Count = FGameConfig::GetDefault().TargetCandidateCount;
+	constexpr int32 NumRuns = 10000;
+
+	FRandomStream Random(11);
+	for(const int32 Num : {8, 32, 128, 512})
+	{
+		const TArray<FTestCandidate> Candidates =
+			MakeCandidates(Random, Origin, Range, Num);
+
+		const auto MeasureUs = [&](const auto &Select) {
+			const double StartTime = FPlatformTime::Seconds();
+			for(int32 Run = 0; Run < NumRuns; ++Run)
+			{
+				Select();
+			}
+			return (FPlatformTime::Seconds() - StartTime) * 1e6 / NumRuns;
+		};
+
+		// Previous selection: a full sort by distance only
+		TArray<TPair<double, int32>> ByDistance;
+		const double SortUs = MeasureUs([&]() {
+			ByDistance.Reset();
+			for(int32 Index = 0; Index < Num; ++Index)
+			{
+				ByDistance.Emplace(FVector::DistSquared(
+									   Origin, Candidates[Index].Location),
+					Index);
+			}
+			ByDistance.Sort([](const TPair<double, int32> &A,
+								const TPair<double, int32> &B) {
+				return A.Key < B.Key;
+			});
+		});
+
+		// Scoring every term one candidate at a time, then sorting
+		TArray<TPair<float, int32>> ByScore;
+		const double ScalarUs = MeasureUs([&]() {
+			ByScore.Reset();
+			for(int32 Index = 0; Index < Num; ++Index)
+			{
+				ByScore.Emplace(ScoreCandidate(Candidates[Index], Origin,
+									Forward, Range, Weights),
+					Index);
+			}
+			ByScore.Sort([](const TPair<float, int32> &A,
+							 const TPair<float, int32> &B) {
+				return A.Key > B.Key;
+			});
+		});
+
+		FMyTargetScorer Scorer;
+		TArray<int32> Best;
+		const double ScorerUs = MeasureUs([&]() {
+			Scorer.Reset(Origin);
+			for(const FTestCandidate &Candidate : Candidates)
+			{
+				Scorer.Add(Candidate.Location, Candidate.bOccluded,
+					Candidate.Threat);
+			}
+			Scorer.Score(Forward, Range, Weights);
+			Scorer.SelectBest(Count, Best);
+		});
+
+		AddInfo(FString::Printf(
+			TEXT("%d candidates, best %d: scorer %.3f us, scalar score and "
+				 "sort %.3f us, distance sort %.3f us"),
+			Num, Count, ScorerUs, ScalarUs, SortUs));
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
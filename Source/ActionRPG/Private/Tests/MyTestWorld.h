@@ -0,0 +1,71 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+
+/**
+ * Transient game world for automation tests. World subsystems are created
+ * as in a game, and actors begin play as they are spawned. Destroyed with
+ * the object.
+ */
+class FMyTestWorld
+{
+public:
+	FMyTestWorld()
+	{
+		World = UWorld::CreateWorld(
+			EWorldType::Game, false, TEXT("ActionRPGTestWorld"));
+		FWorldContext &Context =
+			GEngine->CreateNewWorldContext(EWorldType::Game);
+		Context.SetCurrentWorld(World);
+
+		// No game mode; begin play directly so spawned actors run BeginPlay
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+		if(!World->HasBegunPlay())
+		{
+			World->GetWorldSettings()->NotifyBeginPlay();
+		}
+	}
+
+	~FMyTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	FMyTestWorld(const FMyTestWorld &) = delete;
+	FMyTestWorld &operator=(const FMyTestWorld &) = delete;
+
+	UWorld *Get() const { return World; }
+
+	// Advance actors, components, timers and tickable subsystems
+	void Tick(float DeltaTime = 1.0f / 60.0f)
+	{
+		World->Tick(LEVELTICK_All, DeltaTime);
+	}
+
+	// Spawn an ActorType, or a Blueprint subclass of it when Class is set
+	template<typename ActorType>
+	ActorType *Spawn(const FVector &Location = FVector::ZeroVector,
+		UClass *Class = ActorType::StaticClass())
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride =
+			ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		return World->SpawnActor<ActorType>(
+			Class, Location, FRotator::ZeroRotator, SpawnParams);
+	}
+
+private:
+	UWorld *World = nullptr;
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -9,7 +9,20 @@
 class AMyEnemy;
 
 /**
- * BT Task to attack the player if in range
+ * Per-AI state for UBTTask_AttackPlayer, stored in the tree's node memory
+ */
+struct FBTAttackPlayerMemory
+{
+	// Enemy whose attack the task is waiting on
+	TWeakObjectPtr<AMyEnemy> Enemy;
+
+	FDelegateHandle AttackFinishedHandle;
+};
+
+/**
+ * BT Task to attack the player if in range. Latent: it stays running until
+ * the enemy's attack ends instead of failing every frame while the montage
+ * plays, and gives up early if the player key is cleared.
  */
 UCLASS()
 class ACTIONRPG_API UBTTask_AttackPlayer : public UBTTaskNode
@@ -19,9 +32,20 @@ class ACTIONRPG_API UBTTask_AttackPlayer : public UBTTaskNode
 public:
 	UBTTask_AttackPlayer();
 
+	virtual void InitializeFromAsset(UBehaviorTree &Asset) override;
+
 	virtual EBTNodeResult::Type ExecuteTask(
 		UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory) override;
 
+	virtual void OnTaskFinished(UBehaviorTreeComponent &OwnerComp,
+		uint8 *NodeMemory, EBTNodeResult::Type TaskResult) override;
+
+	virtual uint16 GetInstanceMemorySize() const override;
+	virtual void InitializeMemory(UBehaviorTreeComponent &OwnerComp,
+		uint8 *NodeMemory, EBTMemoryInit::Type InitType) const override;
+	virtual void CleanupMemory(UBehaviorTreeComponent &OwnerComp,
+		uint8 *NodeMemory, EBTMemoryClear::Type CleanupType) const override;
+
 protected:
 	// Blackboard key for the player
 	UPROPERTY(EditAnywhere, Category = "Blackboard")
@@ -30,4 +54,14 @@ protected:
 	// Blackboard key for attack range
 	UPROPERTY(EditAnywhere, Category = "Blackboard")
 	FBlackboardKeySelector AttackRangeKey;
+
+private:
+	// Subscribe to the end of Enemy's attack and the player key
+	EBTNodeResult::Type WaitForAttack(
+		UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory, AMyEnemy *Enemy);
+
+	void OnAttackFinished(TWeakObjectPtr<UBehaviorTreeComponent> OwnerComp);
+
+	EBlackboardNotificationResult OnPlayerKeyChanged(
+		const UBlackboardComponent &Blackboard, FBlackboard::FKey ChangedKeyID);
 };
@@ -9,7 +9,21 @@
 #include "BTTask_FindPlayer.generated.h"
 
 /**
- * BT Task to find the player and store in Blackboard
+ * Per-AI state for UBTTask_FindPlayer, stored in the tree's node memory
+ */
+struct FBTFindPlayerMemory
+{
+	FVector CurrentTargetLocation = FVector::ZeroVector;
+	int32 CurrentPatrolIndex = 0;
+
+	// Patrol point of the last patrol move, the start of the next leg
+	int32 LastPatrolIndex = INDEX_NONE;
+	bool bHasTarget = false;
+};
+
+/**
+ * BT Task to find the player and store in Blackboard. Runs non-instanced:
+ * patrol state lives in FBTFindPlayerMemory, not on the shared node.
  */
 UCLASS()
 class ACTIONRPG_API UBTTask_FindPlayer : public UBTTaskNode
@@ -19,21 +33,29 @@ class ACTIONRPG_API UBTTask_FindPlayer : public UBTTaskNode
 public:
 	UBTTask_FindPlayer();
 
+	virtual void InitializeFromAsset(UBehaviorTree &Asset) override;
+
 	virtual EBTNodeResult::Type ExecuteTask(
 		UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory) override;
 
 	virtual void TickTask(UBehaviorTreeComponent &OwnerComp, uint8 *NodeMemory,
 		float DeltaSeconds) override;
 
+	virtual void OnTaskFinished(UBehaviorTreeComponent &OwnerComp,
+		uint8 *NodeMemory, EBTNodeResult::Type TaskResult) override;
+
+	virtual uint16 GetInstanceMemorySize() const override;
+	virtual void InitializeMemory(UBehaviorTreeComponent &OwnerComp,
+		uint8 *NodeMemory, EBTMemoryInit::Type InitType) const override;
+	virtual void CleanupMemory(UBehaviorTreeComponent &OwnerComp,
+		uint8 *NodeMemory, EBTMemoryClear::Type CleanupType) const override;
+
 protected:
 	// Blackboard key to store the player
 	UPROPERTY(EditAnywhere, Category = "Blackboard")
 	FBlackboardKeySelector PlayerKey;
 
 private:
-	void StartMovement(AAIController *AIController, AMyEnemy *Enemy);
-
-	FVector CurrentTargetLocation;
-	bool bHasTarget;
-	int32 CurrentPatrolIndex = 0;
+	void StartMovement(AAIController *AIController, AMyEnemy *Enemy,
+		FBTFindPlayerMemory &Memory) const;
 };
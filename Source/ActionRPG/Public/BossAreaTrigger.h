@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "MyGameConfig.h"
 #include "BossAreaTrigger.generated.h"
 
 class AMyBoss;
@@ -17,6 +18,12 @@ public:
 	ABossAreaTrigger();
 
 	virtual void BeginPlay() override;
+	virtual void OnConstruction(const FTransform &Transform) override;
+
+	UFUNCTION()
+	void OnPrewarmOverlapBegin(UPrimitiveComponent *OverlappedComp,
+		AActor *OtherActor, UPrimitiveComponent *OtherComp,
+		int32 OtherBodyIndex, bool bFromSweep, const FHitResult &SweepResult);
 
 	UFUNCTION()
 	void OnOverlapBegin(UPrimitiveComponent *OverlappedComp, AActor *OtherActor,
@@ -26,6 +33,14 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Trigger")
 	class UBoxComponent *TriggerBox;
 
+	// Outer volume that streams the boss's assets in ahead of activation
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Trigger")
+	class UBoxComponent *PrewarmBox;
+
+	// How far the pre-warm volume extends past the trigger on each side
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trigger")
+	float PrewarmDistance = FGameConfig::GetDefault().BossPrewarmDistance;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Boss")
 	TSoftObjectPtr<AMyBoss> BossToActivate;
 
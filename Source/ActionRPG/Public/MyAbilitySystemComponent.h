@@ -6,8 +6,96 @@
 #include "CoreMinimal.h"
 #include "MyAbilitySystemComponent.generated.h"
 
+class UMyAttackAbility;
+
+// Key for outgoing damage specs cached per attacker
+struct FMyDamageSpecKey
+{
+	TObjectKey<UClass> EffectClass;
+	float Level = 0.0f;
+
+	bool operator==(const FMyDamageSpecKey &Other) const
+	{
+		return EffectClass == Other.EffectClass && Level == Other.Level;
+	}
+
+	friend uint32 GetTypeHash(const FMyDamageSpecKey &Key)
+	{
+		return HashCombine(
+			GetTypeHash(Key.EffectClass), GetTypeHash(Key.Level));
+	}
+};
+
 UCLASS()
 class ACTIONRPG_API UMyAbilitySystemComponent : public UAbilitySystemComponent
 {
 	GENERATED_BODY()
+
+public:
+	// Currently active attack ability instance, nullptr if not attacking
+	UMyAttackAbility *GetActiveAttackAbility() const
+	{
+		return ActiveAttackAbility;
+	}
+
+	// Check if an attack ability has been granted to this component
+	bool HasAttackAbility() const { return NumGrantedAttackAbilities > 0; }
+
+	// Delegate fired when the active attack ability starts or ends
+	DECLARE_MULTICAST_DELEGATE_OneParam(
+		FOnActiveAttackAbilityChanged, UMyAttackAbility *);
+	FOnActiveAttackAbilityChanged OnActiveAttackAbilityChanged;
+
+	// Get a reusable outgoing damage spec for the effect class and level.
+	// The spec is shared between hits, so callers only patch SetByCaller
+	// magnitudes before applying it. Its effect context (instigator and
+	// causer are this owner) is kept for the owner's lifetime; captured
+	// source tags and snapshotted source attributes are recaptured on the
+	// first use after RefreshDamageSpecs.
+	FGameplayEffectSpecHandle GetCachedDamageSpec(
+		TSubclassOf<UGameplayEffect> EffectClass, float Level);
+
+	// Apply a cached damage spec to Target with the given Data.Damage value
+	FActiveGameplayEffectHandle ApplyCachedDamageSpec(
+		TSubclassOf<UGameplayEffect> EffectClass, float Level, float Damage,
+		UAbilitySystemComponent *Target);
+
+	// Recapture source data into the cached specs on their next use. Called
+	// on every ability activation and by attacks that don't use abilities.
+	void RefreshDamageSpecs() { ++DamageSpecSerial; }
+
+	// Drop all cached damage specs (e.g. when the owner is reset)
+	void ClearDamageSpecCache() { DamageSpecCache.Reset(); }
+
+	virtual void NotifyAbilityActivated(const FGameplayAbilitySpecHandle Handle,
+		UGameplayAbility *Ability) override;
+	virtual void NotifyAbilityEnded(FGameplayAbilitySpecHandle Handle,
+		UGameplayAbility *Ability, bool bWasCancelled) override;
+
+protected:
+	virtual void OnGiveAbility(FGameplayAbilitySpec &AbilitySpec) override;
+	virtual void OnRemoveAbility(FGameplayAbilitySpec &AbilitySpec) override;
+
+private:
+	void SetActiveAttackAbility(UMyAttackAbility *NewAbility);
+
+	// Active attack ability instance, tracked through activate/end hooks
+	UPROPERTY(Transient)
+	UMyAttackAbility *ActiveAttackAbility = nullptr;
+
+	// Number of granted specs whose ability is a UMyAttackAbility
+	int32 NumGrantedAttackAbilities = 0;
+
+	struct FCachedDamageSpec
+	{
+		FGameplayEffectSpecHandle Spec;
+		uint32 Serial = 0;
+	};
+
+	// Prepared outgoing damage specs, reused across hits
+	TMap<FMyDamageSpecKey, FCachedDamageSpec> DamageSpecCache;
+
+	// Bumped by RefreshDamageSpecs; cached specs with an older serial
+	// recapture their source data
+	uint32 DamageSpecSerial = 0;
 };
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "Engine/EngineTypes.h"
+#include "MyGameplayTags.h"
 #include "MyAbilityTypes.generated.h"
 
 UENUM(BlueprintType)
@@ -14,19 +16,7 @@ enum class EMyAbilityInputID : uint8
 	Attack UMETA(DisplayName = "Attack")
 };
 
-// Gameplay Tag Constants
-namespace AbilityTags
-{
-const FName Sprint = FName("Ability.Sprint");
-const FName Jump = FName("Ability.Jump");
-const FName Dodge = FName("Ability.Dodge");
-const FName Attack = FName("Ability.Attack");
-} // namespace AbilityTags
-
-namespace StateTags
-{
-const FName Sprinting = FName("State.Sprinting");
-}
+// Gameplay tag constants live in MyGameplayTags.h
 
 // Component Name Constants
 namespace ComponentNames
@@ -36,4 +26,16 @@ const FName Camera = FName("Camera");
 const FName AttributeComponent = FName("AttributeComponent");
 const FName AbilitySystemComponent = FName("AbilitySystemComponent");
 const FName HealthBarWidget = FName("HealthBarWidget");
-} // namespace ComponentNames
\ No newline at end of file
+const FName Hurtbox = FName("Hurtbox");
+} // namespace ComponentNames
+
+// Hurtbox object channels (Config/DefaultEngine.ini)
+#define ECC_PlayerHurtbox ECC_GameTraceChannel1
+#define ECC_EnemyHurtbox ECC_GameTraceChannel2
+
+// Collision Profile Constants
+namespace CollisionProfiles
+{
+const FName PlayerHurtbox = FName("PlayerHurtbox");
+const FName EnemyHurtbox = FName("EnemyHurtbox");
+} // namespace CollisionProfiles
\ No newline at end of file
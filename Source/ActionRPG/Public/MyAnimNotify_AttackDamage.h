@@ -3,25 +3,30 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Animation/AnimNotifies/AnimNotify.h"
 #include "GameplayEffect.h"
 #include "MyGameConfig.h"
+#include "MyGameplayAnimNotify.h"
 #include "MyAnimNotify_AttackDamage.generated.h"
 
+class AMyBaseCharacter;
+class UMyHitQuerySubsystem;
+struct FMyAttackSweepRequest;
+struct FMyMontageTrajectory;
+
 /**
- * Animation notify to perform attack trace and apply damage
+ * Animation notify to queue an attack trace; damage is applied by
+ * UMyHitQuerySubsystem once the async trace completes
  */
 UCLASS(Blueprintable)
-class ACTIONRPG_API UMyAnimNotify_AttackDamage : public UAnimNotify
+class ACTIONRPG_API UMyAnimNotify_AttackDamage : public UMyGameplayAnimNotify
 {
 	GENERATED_BODY()
 
 public:
 	UMyAnimNotify_AttackDamage();
 
-	virtual void Notify(USkeletalMeshComponent *MeshComp,
-		UAnimSequenceBase *Animation,
-		const FAnimNotifyEventReference &EventReference) override;
+	virtual void HandleNotify(AActor *Owner, const UAnimMontage *Montage,
+		float Position) override;
 
 	// Trace properties
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
@@ -35,6 +40,11 @@ public:
 		FGameConfig::GetDefault().AttackTraceOffsetY,
 		FGameConfig::GetDefault().AttackTraceOffsetZ);
 
+	// Seconds of baked weapon path (see UMyWeaponTrajectoryAsset) swept up
+	// to this notify; the fixed trace above is used when none is baked
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
+	float TrajectoryWindow = 0.15f;
+
 	// Damage properties
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Damage")
 	float DamageAmount = 20.0f;
@@ -43,5 +53,12 @@ public:
 	TSubclassOf<UGameplayEffect> DamageEffectClass;
 
 protected:
-	void PerformTraceAndApplyDamage(AActor *OwnerActor);
+	// Queue the attack sweep with the world's hit query subsystem
+	void PerformTraceAndApplyDamage(
+		AActor *OwnerActor, const UAnimMontage *Montage, float Position);
+
+	// Queue one capsule sweep per baked frame in the window before Position
+	void QueueTrajectorySweeps(UMyHitQuerySubsystem &HitQuery,
+		const AMyBaseCharacter &Character, FMyAttackSweepRequest Request,
+		const FMyMontageTrajectory &Trajectory, float Position) const;
 };
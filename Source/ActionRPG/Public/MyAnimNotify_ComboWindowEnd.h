@@ -2,21 +2,21 @@
 
 #pragma once
 
-#include "Animation/AnimNotifies/AnimNotify.h"
 #include "CoreMinimal.h"
+#include "MyGameplayAnimNotify.h"
 #include "MyAnimNotify_ComboWindowEnd.generated.h"
 
 /**
  * Animation notify to end combo window
  */
 UCLASS()
-class ACTIONRPG_API UMyAnimNotify_ComboWindowEnd : public UAnimNotify
+class ACTIONRPG_API UMyAnimNotify_ComboWindowEnd : public UMyGameplayAnimNotify
 {
 	GENERATED_BODY()
 
 public:
 	UMyAnimNotify_ComboWindowEnd();
 
-	virtual void Notify(USkeletalMeshComponent *MeshComp,
-		UAnimSequenceBase *Animation) override;
+	virtual void HandleNotify(AActor *Owner, const UAnimMontage *Montage,
+		float Position) override;
 };
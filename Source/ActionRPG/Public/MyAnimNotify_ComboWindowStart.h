@@ -2,21 +2,22 @@
 
 #pragma once
 
-#include "Animation/AnimNotifies/AnimNotify.h"
 #include "CoreMinimal.h"
+#include "MyGameplayAnimNotify.h"
 #include "MyAnimNotify_ComboWindowStart.generated.h"
 
 /**
  * Animation notify to start combo window
  */
 UCLASS()
-class ACTIONRPG_API UMyAnimNotify_ComboWindowStart : public UAnimNotify
+class ACTIONRPG_API UMyAnimNotify_ComboWindowStart
+	: public UMyGameplayAnimNotify
 {
 	GENERATED_BODY()
 
 public:
 	UMyAnimNotify_ComboWindowStart();
 
-	virtual void Notify(USkeletalMeshComponent *MeshComp,
-		UAnimSequenceBase *Animation) override;
+	virtual void HandleNotify(AActor *Owner, const UAnimMontage *Montage,
+		float Position) override;
 };
@@ -29,6 +29,8 @@ public:
 		const FGameplayAbilityActorInfo *ActorInfo,
 		const FGameplayAbilityActivationInfo ActivationInfo,
 		bool bReplicateEndAbility, bool bWasCancelled) override;
+	virtual void OnGiveAbility(const FGameplayAbilityActorInfo *ActorInfo,
+		const FGameplayAbilitySpec &Spec) override;
 
 	// Called when attack input is pressed
 	void OnAttackInputPressed();
@@ -54,6 +56,12 @@ public:
 	// Get max combo index (MaxComboCount - 1)
 	int32 GetMaxComboIndex() const { return MaxComboCount - 1; }
 
+	// Montages for each combo level
+	const TArray<UAnimMontage *> &GetAttackMontages() const
+	{
+		return AttackMontages;
+	}
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
 	UNiagaraSystem *AttackParticleEffect;
 
@@ -36,6 +36,13 @@ public:
 	// Implement IAbilitySystemInterface
 	virtual UAbilitySystemComponent *GetAbilitySystemComponent() const override;
 
+	// Abilities granted on initialization
+	const TArray<TSubclassOf<UMyGameplayAbility>> &GetDefaultAbilityClasses()
+		const
+	{
+		return DefaultAbilityClasses;
+	}
+
 	virtual void BeginPlay() override;
 	virtual void OnRegister() override;
 
@@ -43,17 +50,34 @@ public:
 	void InitializeAttributes();
 	void GiveDefaultAbilities();
 	void InitializeAbilitySystem();
-	void DeferredInitialize();
 
-	// Initialize attribute component (called by owner)
-	void InitializeAttributeComponent();
+	// Initialize the ability system once the owner and ASC are ready.
+	// Called from every initialization event (OnRegister, BeginPlay, the
+	// owner's PossessedBy and OnRep_PlayerState); runs once and returns
+	// whether the ability system is initialized.
+	bool TryInitializeAbilitySystem();
+
+	// The owner's controller or player state changed
+	void RefreshAbilityActorInfo();
+
+	bool IsAbilitySystemInitialized() const
+	{
+		return bAbilitySystemInitialized;
+	}
 
 	// Initialize default attributes with config values
 	void InitializeDefaultAttributes();
 
+	// Override the attributes with the component's default values
+	void ApplyDefaultAttributeValues();
+
+	// Return the ability system to its freshly initialized state for a
+	// pooled owner: cancels abilities, removes active effects and loose
+	// tags, then reapplies default attributes and attribute effects
+	void ResetAbilitySystem();
+
 	// Helper methods for initialization
 	bool IsReadyForInitialization() const;
-	void ScheduleRetryInitialization();
 	bool CanInitializeAbilitySystem() const;
 	void SetupAttributeChangeDelegates();
 	void SetInitialCharacterMovement();
@@ -91,6 +115,10 @@ public:
 	// Handle death when health <= 0
 	void HandleDeath();
 
+	// Whether HandleDeath gives the owner a life span; owners that remove
+	// themselves on death (pooled enemies) turn this off
+	bool bDestroyOwnerOnDeath = true;
+
 	// Delegate for health changes
 	DECLARE_MULTICAST_DELEGATE_OneParam(FOnHealthChanged, float);
 	FOnHealthChanged OnHealthChanged;
@@ -98,6 +126,12 @@ public:
 	// Public accessor for health changed delegate
 	FOnHealthChanged &GetOnHealthChanged() { return OnHealthChanged; }
 
+	// Get the ability system component with its project-specific API
+	UMyAbilitySystemComponent *GetMyAbilitySystemComponent() const
+	{
+		return AbilitySystemComponent;
+	}
+
 	// Get the attribute set
 	UMyAttributeSet *GetAttributeSet() const { return AttributeSet; }
 
@@ -184,8 +218,11 @@ protected:
 	// Try to initialize ability actor info
 	bool TryInitializeAbilityActorInfo();
 
-	// Handle initialization retry logic
-	void HandleInitializationRetry();
+	// Override the attributes in one instant spec; zero values fall back
+	// to the config defaults
+	void ApplyAttributeValues(const FDefaultAttributes &Attributes);
+
+	bool bAbilitySystemInitialized = false;
 
 	bool bIsSprinting = false;
 	bool bIsDodging = false;
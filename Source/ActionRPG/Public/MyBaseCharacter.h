@@ -10,6 +10,8 @@
 #include "MyBaseCharacter.generated.h"
 
 class UMyAttributeComponent;
+class UMyHurtboxComponent;
+class UMyWeaponTrajectoryAsset;
 
 UCLASS(Abstract)
 class ACTIONRPG_API AMyBaseCharacter : public ACharacter
@@ -20,8 +22,13 @@ public:
 	AMyBaseCharacter();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 
+	// Possession changes the ability actor info (or completes GAS init)
+	virtual void PossessedBy(AController *NewController) override;
+	virtual void OnRep_PlayerState() override;
+
 	// Get the ability system component from the AttributeComponent
 	UFUNCTION(BlueprintPure, Category = "Abilities")
 	UAbilitySystemComponent *GetAbilitySystem() const
@@ -31,6 +38,20 @@ public:
 				   : nullptr;
 	}
 
+	// Get the project ability system component (active attack tracking)
+	UMyAbilitySystemComponent *GetMyAbilitySystem() const
+	{
+		return AttributeComponent
+				   ? AttributeComponent->GetMyAbilitySystemComponent()
+				   : nullptr;
+	}
+
+	// Get the component that receives combat hits
+	UMyHurtboxComponent *GetHurtboxComponent() const
+	{
+		return HurtboxComponent;
+	}
+
 	// Get the AttributeComponent
 	UFUNCTION(BlueprintPure, Category = "Attributes")
 	UMyAttributeComponent *GetAttributeComponent() const
@@ -61,11 +82,30 @@ public:
 	// Check if ability system is ready for use
 	bool IsAbilitySystemReady() const { return IsAttributeSystemValid(); }
 
-	// Handle damage taken
+	// Handle damage taken; queued with the combat resolution subsystem.
+	// Returns the amount queued, not applied: health changes when the
+	// subsystem flushes (within the frame), unless the target dies first.
 	virtual float TakeDamage(float DamageAmount,
 		struct FDamageEvent const &DamageEvent,
 		class AController *EventInstigator, AActor *DamageCauser) override;
 
+	// Apply damage as a single attribute change, then run the resolved
+	// damage handling (stun, death). Uses DamageEffectClass through GAS when
+	// set, otherwise modifies Health directly.
+	void ApplyResolvedDamage(float DamageAmount, AActor *DamageCauser,
+		TSubclassOf<UGameplayEffect> DamageEffectClass = nullptr);
+
+	// Attribute change of ApplyResolvedDamage alone, for batches with
+	// several causers. Returns false if the ability system isn't ready.
+	bool ApplyDamageAttribute(float DamageAmount, AActor *DamageCauser,
+		TSubclassOf<UGameplayEffect> DamageEffectClass = nullptr);
+
+	// Run the resolved damage handling once for a whole batch
+	void NotifyDamageResolved(float DamageAmount, AActor *DamageCauser)
+	{
+		OnDamageResolved(DamageAmount, DamageCauser);
+	}
+
 	// Handle death - to be implemented by subclasses
 	virtual void HandleDeath();
 
@@ -84,7 +124,24 @@ public:
 	TSubclassOf<UMyAttributeComponent> AttributeComponentClass =
 		UMyAttributeComponent::StaticClass();
 
+	// Query-only capsule found by the opposing team's attack sweeps
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Combat")
+	UMyHurtboxComponent *HurtboxComponent;
+
+	// Baked weapon paths used by attack notifies instead of a fixed sweep
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+	UMyWeaponTrajectoryAsset *WeaponTrajectories;
+
+	// Attack montages to bake weapon trajectories for (editor bake step)
+	virtual void GetAttackMontages(TArray<UAnimMontage *> &OutMontages) const;
+
 	// Death status
 	UPROPERTY(BlueprintReadOnly, Category = "Animation")
 	bool bIsDead = false;
+
+protected:
+	// Called once per resolved damage batch, after health was updated
+	virtual void OnDamageResolved(float DamageAmount, AActor *DamageCauser)
+	{
+	}
 };
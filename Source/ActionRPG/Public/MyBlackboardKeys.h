@@ -0,0 +1,88 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Float.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Object.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Vector.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "CoreMinimal.h"
+
+class UBlackboardData;
+
+// Blackboard Key Name Constants (enemy blackboard)
+namespace BlackboardKeyNames
+{
+const FName AttackRange = FName("AttackRange");
+const FName PatrolLocation = FName("PatrolLocation");
+} // namespace BlackboardKeyNames
+
+/**
+ * Key IDs of the enemy blackboard, resolved once when the blackboard is
+ * initialized so AI code never looks keys up by name
+ */
+struct ACTIONRPG_API FMyEnemyBlackboardKeys
+{
+	FBlackboard::FKey AttackRange = FBlackboard::InvalidKey;
+	FBlackboard::FKey PatrolLocation = FBlackboard::InvalidKey;
+
+	// Resolve every key against Asset; returns the names it lacks
+	TArray<FName> Resolve(const UBlackboardData &Asset);
+};
+
+// Typed blackboard access by key ID. Missing keys read as the key type's
+// invalid value and ignore writes.
+namespace MyBlackboard
+{
+template<typename TKeyType>
+typename TKeyType::FDataType GetValue(
+	const UBlackboardComponent *Blackboard, FBlackboard::FKey KeyID)
+{
+	if(!Blackboard || KeyID == FBlackboard::InvalidKey)
+	{
+		return TKeyType::InvalidValue;
+	}
+	return Blackboard->GetValue<TKeyType>(KeyID);
+}
+
+template<typename TKeyType>
+bool SetValue(UBlackboardComponent *Blackboard, FBlackboard::FKey KeyID,
+	typename TKeyType::FDataType Value)
+{
+	if(!Blackboard || KeyID == FBlackboard::InvalidKey)
+	{
+		return false;
+	}
+	return Blackboard->SetValue<TKeyType>(KeyID, Value);
+}
+
+inline UObject *GetObject(
+	const UBlackboardComponent *Blackboard, FBlackboard::FKey KeyID)
+{
+	return GetValue<UBlackboardKeyType_Object>(Blackboard, KeyID);
+}
+
+inline bool SetObject(
+	UBlackboardComponent *Blackboard, FBlackboard::FKey KeyID, UObject *Value)
+{
+	return SetValue<UBlackboardKeyType_Object>(Blackboard, KeyID, Value);
+}
+
+inline float GetFloat(
+	const UBlackboardComponent *Blackboard, FBlackboard::FKey KeyID)
+{
+	return GetValue<UBlackboardKeyType_Float>(Blackboard, KeyID);
+}
+
+inline bool SetFloat(
+	UBlackboardComponent *Blackboard, FBlackboard::FKey KeyID, float Value)
+{
+	return SetValue<UBlackboardKeyType_Float>(Blackboard, KeyID, Value);
+}
+
+inline bool SetVector(UBlackboardComponent *Blackboard, FBlackboard::FKey KeyID,
+	const FVector &Value)
+{
+	return SetValue<UBlackboardKeyType_Vector>(Blackboard, KeyID, Value);
+}
+} // namespace MyBlackboard
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "MyEnemy.h"
+#include "Engine/StreamableManager.h"
 #include "MyBoss.generated.h"
 
 UENUM(BlueprintType)
@@ -23,7 +24,6 @@ public:
 	AMyBoss();
 
 	virtual void BeginPlay() override;
-	virtual void Tick(float DeltaTime) override;
 
 	// Override attack to use boss-specific attacks
 	virtual void AttackPlayer(ACharacter *Player) override;
@@ -37,20 +37,19 @@ public:
 	// Handle combo interruption
 	void OnComboInterrupted();
 
-	// Override TakeDamage for boss-specific behavior
-	virtual float TakeDamage(float DamageAmount,
-		struct FDamageEvent const &DamageEvent,
-		class AController *EventInstigator, AActor *DamageCauser) override;
-
 	// Montage end callback
 	void OnAttackMontageEnded(UAnimMontage *Montage, bool bInterrupted);
 
 	// Select random attack type
 	EBossAttackType SelectRandomAttack();
 
-	// Play the selected attack
+	// Play the selected attack; false while the montages are still streaming
 	bool PlayAttack(EBossAttackType AttackType);
 
+	// Boss attack montages in addition to any ability montages
+	virtual void GetAttackMontages(
+		TArray<UAnimMontage *> &OutMontages) const override;
+
 	// Check if boss can be stunned
 	bool CanBeStunned() const;
 
@@ -61,19 +60,30 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category = "Boss")
 	bool bActivated = false;
 
+	// Start streaming the heavy assets in; safe to call repeatedly
+	void PrewarmAssets();
+
+	// True once the heavy assets are in memory (or have finished streaming,
+	// even if some failed); attacks wait for this
+	bool AreAssetsLoaded() const;
+
 	// Spear mesh for boss
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Mesh")
 	UStaticMeshComponent *SpearMesh;
 
-	// Attack montages
+	// Spear asset, streamed in and applied to SpearMesh by PrewarmAssets
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh")
+	TSoftObjectPtr<UStaticMesh> SpearMeshAsset;
+
+	// Attack montages (soft; streamed in by PrewarmAssets)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation")
-	UAnimMontage *Attack1Montage;
+	TSoftObjectPtr<UAnimMontage> Attack1Montage;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation")
-	UAnimMontage *Attack2Montage;
+	TSoftObjectPtr<UAnimMontage> Attack2Montage;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation")
-	UAnimMontage *ComboMontage;
+	TSoftObjectPtr<UAnimMontage> ComboMontage;
 
 	// Animation state
 	UPROPERTY(BlueprintReadOnly, Category = "Animation")
@@ -84,4 +94,16 @@ public:
 
 	// Timer handle for attack reset
 	FTimerHandle AttackResetTimerHandle;
+
+private:
+	// Apply the streamed spear mesh
+	void OnAssetsLoaded();
+
+	// Keeps the streamed assets in memory while the boss exists
+	TSharedPtr<FStreamableHandle> AssetsHandle;
+
+protected:
+	// Boss-specific reaction to a resolved damage batch
+	virtual void OnDamageResolved(
+		float DamageAmount, AActor *DamageCauser) override;
 };
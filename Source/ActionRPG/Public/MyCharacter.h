@@ -11,6 +11,7 @@
 #include "MyAttackAbility.h"
 #include "MyAttributeComponent.h"
 #include "MyPlayerUI.h"
+#include "MyTargetScorer.h"
 #include "MyCharacter.generated.h"
 
 class AMyEnemy;
@@ -71,6 +72,12 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Character State")
 	bool IsAttacking() const;
 
+	/**
+	 * @brief Get the active attack ability (O(1), tracked by the ASC)
+	 * @return Pointer to active attack ability, nullptr if none
+	 */
+	UMyAttackAbility *GetActiveAttackAbility() const;
+
 	/**
 	 * @brief Get current combo index for Animation Blueprint
 	 * @return Current combo index in attack sequence, 0 if not attacking
@@ -84,10 +91,7 @@ public:
 	 * @return True if enemy is in nearby enemies list
 	 */
 	UFUNCTION(BlueprintPure, Category = "Targeting")
-	bool IsEnemyInFocusRange(AMyEnemy *Enemy) const
-	{
-		return NearbyEnemies.Contains(Enemy);
-	}
+	bool IsEnemyInFocusRange(AMyEnemy *Enemy) const;
 
 	/**
 	 * @brief Check if enemy is currently focused/targeted
@@ -105,6 +109,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	virtual void PossessedBy(AController *NewController) override;
 
@@ -181,22 +186,11 @@ public:
 	float DodgeCooldown = FGameConfig::GetDefault().DodgeCooldown;
 
 private:
-	/**
-	 * @brief Initialize the attribute component
-	 */
-	void InitializeAttributeComponent();
-
 	/**
 	 * @brief Create and setup the player UI
 	 */
 	void InitializePlayerUI();
 
-	/**
-	 * @brief Helper to get the active attack ability
-	 * @return Pointer to active attack ability, nullptr if none
-	 */
-	UMyAttackAbility *GetActiveAttackAbility() const;
-
 	/**
 	 * @brief Check if character can perform abilities (not attacking and
 	 * ability system ready)
@@ -228,28 +222,52 @@ private:
 
 	// Enemy targeting
 	AMyEnemy *CurrentTarget;
-	TArray<AMyEnemy *> NearbyEnemies;
-	TArray<AMyEnemy *> PreviousNearbyEnemies;
 	bool bCameraLocked;
 	FTimerHandle UpdateEnemiesTimerHandle;
 
+	// Enemy registry range watch around the player (detection range)
+	int32 EnemyRangeWatch = INDEX_NONE;
+
+	// Activated enemies in detection range; kept between updates so only
+	// changes touch health bars
+	TSet<TWeakObjectPtr<AMyEnemy>> NearbyEnemies;
+
+	// Enemies in range that aren't activated yet (bosses), rechecked on
+	// every update
+	TArray<TWeakObjectPtr<AMyEnemy>> InactiveNearbyEnemies;
+
+	// Best scored nearby enemies, best first (at most
+	// TargetCandidateCount), as of the last SelectTargetCandidates;
+	// FocusEnemy picks the best of these and CycleTarget walks them
+	// clockwise around the player
+	TArray<TWeakObjectPtr<AMyEnemy>> TargetCandidates;
+	FMyTargetScorer TargetScorer;
+	TArray<int32> BestCandidateIndices;
+
+	// Scratch lists reused by every update
+	TArray<AMyEnemy *> EnemiesInRange;
+	TArray<AMyEnemy *> EnteredEnemies;
+	TArray<TWeakObjectPtr<AMyEnemy>> ExitedEnemies;
+
 	/**
 	 * @brief Update the list of nearby enemies and their UI state
 	 */
 	void UpdateNearbyEnemies();
 
 	/**
-	 * @brief Find all enemies within detection range
+	 * @brief Apply the enemies the range watch reports as entered or left
+	 * to the nearby set, filling EnteredEnemies and ExitedEnemies
 	 */
-	void FindNearbyEnemies();
+	void DiffNearbyEnemies();
 
 	/**
-	 * @brief Sort nearby enemies by distance from character
+	 * @brief Score the nearby enemies and keep the best few as targets.
+	 * Only run when a target is about to be picked.
 	 */
-	void SortEnemiesByDistance();
+	void SelectTargetCandidates();
 
 	/**
-	 * @brief Update health bar visibility for nearby enemies
+	 * @brief Show or hide health bars of enemies that entered or left range
 	 */
 	void UpdateHealthBarVisibility();
 
@@ -258,6 +276,12 @@ private:
 	 */
 	void ValidateCurrentTarget();
 
+	/**
+	 * @brief Get the best scored candidate that is still alive
+	 * @return The enemy, or nullptr if there is none
+	 */
+	AMyEnemy *GetBestTargetCandidate() const;
+
 	/**
 	 * @brief Set the current target enemy with proper state management
 	 * @param NewTarget The enemy to target, nullptr to clear target
@@ -270,7 +294,7 @@ private:
 	void ClearTarget();
 
 	/**
-	 * @brief Cycle to the next enemy target
+	 * @brief Cycle to the next candidate clockwise from the current target
 	 */
 	void CycleTarget();
 };
@@ -0,0 +1,95 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffect.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MyCombatResolutionSubsystem.generated.h"
+
+class AMyBaseCharacter;
+
+/**
+ * A single damage event waiting to be resolved
+ */
+USTRUCT()
+struct FMyDamageEvent
+{
+	GENERATED_BODY()
+
+	// Character receiving the damage
+	TWeakObjectPtr<AMyBaseCharacter> Target;
+
+	// Actor that caused the damage
+	TWeakObjectPtr<AActor> DamageCauser;
+
+	float DamageAmount = 0.0f;
+
+	// When set, damage is applied to the target's ability system through
+	// this effect; otherwise it is applied as a direct attribute change
+	TSubclassOf<UGameplayEffect> DamageEffectClass;
+};
+
+/**
+ * Gathers every damage event raised during a frame and merges them per
+ * target, so each target receives one attribute change per causer and
+ * damage effect, and one stun/death transition per frame
+ */
+UCLASS()
+class ACTIONRPG_API UMyCombatResolutionSubsystem
+	: public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Queue damage for resolution at the end of the frame
+	void QueueDamage(const FMyDamageEvent &DamageEvent);
+
+	// Resolve all queued damage now
+	void FlushPendingDamage();
+
+	// True while queued damage is being applied
+	bool IsResolving() const { return bIsResolving; }
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(
+		const EWorldType::Type WorldType) const override;
+
+private:
+	// Damage merged for one causer and effect on a target
+	struct FDamageContribution
+	{
+		TWeakObjectPtr<AActor> DamageCauser;
+		TSubclassOf<UGameplayEffect> DamageEffectClass;
+		float Damage = 0.0f;
+	};
+
+	// Damage merged for one target, kept per causer so each hit is
+	// attributed to the actor that dealt it
+	struct FPendingTargetDamage
+	{
+		TWeakObjectPtr<AMyBaseCharacter> Target;
+		TArray<FDamageContribution, TInlineAllocator<2>> Contributions;
+		float TotalDamage = 0.0f;
+	};
+
+	void ResolveTarget(const FPendingTargetDamage &Pending) const;
+
+	// Targets in first-hit order, so resolution is deterministic
+	TArray<FPendingTargetDamage> PendingTargets;
+
+	// Targets being resolved (swapped with PendingTargets on flush)
+	TArray<FPendingTargetDamage> ResolvingTargets;
+
+	// Target -> index into PendingTargets
+	TMap<TWeakObjectPtr<AMyBaseCharacter>, int32> PendingTargetIndices;
+
+	// Counters since the last stat update
+	int32 EventsQueuedThisFrame = 0;
+	int32 TargetsResolvedThisFrame = 0;
+
+	bool bIsResolving = false;
+};
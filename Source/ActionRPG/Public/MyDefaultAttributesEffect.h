@@ -0,0 +1,20 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffect.h"
+#include "MyDefaultAttributesEffect.generated.h"
+
+/**
+ * Instant effect that overrides every default attribute in one spec; the
+ * values are passed as SetByCaller magnitudes (DataTags)
+ */
+UCLASS()
+class ACTIONRPG_API UMyDefaultAttributesEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UMyDefaultAttributesEffect();
+};
@@ -19,7 +19,7 @@ public:
 	AMyEnemy();
 
 	virtual void BeginPlay() override;
-	virtual void Tick(float DeltaTime) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// Get the ability system component from the AttributeComponent
 	UAbilitySystemComponent *GetAbilitySystem() const;
@@ -34,6 +34,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Animation")
 	void ResetAttackState();
 
+	// Delegate for the end of an attack (montage ended or reset)
+	DECLARE_MULTICAST_DELEGATE(FOnAttackFinished);
+	FOnAttackFinished OnAttackFinished;
+
+	// Public accessor for attack finished delegate
+	FOnAttackFinished &GetOnAttackFinished() { return OnAttackFinished; }
+
 	// Initialize health bar widget
 	void InitializeHealthBar();
 
@@ -43,14 +50,15 @@ public:
 	// Handle enemy-specific health changes
 	void OnEnemyHealthChanged(float NewHealth);
 
-	// Apply damage
-	virtual float TakeDamage(float DamageAmount,
-		struct FDamageEvent const &DamageEvent,
-		class AController *EventInstigator, AActor *DamageCauser) override;
-
 	// Set stun state (for animation)
 	void SetStunned(bool bStunned);
 
+	// Stun for Duration seconds, restarting any stun already running
+	void StunFor(float Duration);
+
+	// Clear stun (stun timer callback)
+	void ClearStun();
+
 	// Set health bar visibility
 	void SetHealthBarVisible(bool bVisible);
 
@@ -60,9 +68,21 @@ public:
 	// Check if enemy is activated (for boss mechanics)
 	virtual bool IsActivated() const { return true; }
 
+	// Lock-on threat in [0, 1]: attacking enemies first, stunned ones last
+	float GetTargetThreat() const
+	{
+		return bIsAttacking ? 1.0f : (bIsStunned ? 0.0f : 0.5f);
+	}
+
 	// Handle death - override from base class
 	virtual void HandleDeath() override;
 
+	// Hide, stop and unregister the enemy while it waits in the pool
+	void DeactivateForPool();
+
+	// Reset the enemy to a fresh state at Transform and resume it
+	void ReactivateFromPool(const FTransform &Transform);
+
 	UPROPERTY(BlueprintReadOnly, Category = "AI")
 	float MovementSpeed = FGameConfig::GetDefault().EnemyMovementSpeed;
 
@@ -109,6 +129,10 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Animation")
 	float DeathDelay = FGameConfig::GetDefault().DeathLifeSpan;
 
+	// Return to the enemy pool after DeathDelay instead of being destroyed
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AI")
+	bool bReturnToPoolOnDeath = true;
+
 	// Montage end callback
 	UFUNCTION()
 	void OnAttackMontageEnded(UAnimMontage *Montage, bool bInterrupted);
@@ -116,4 +140,25 @@ public:
 	float LastAttackTime = 0.0f;
 
 	ACharacter *PlayerCharacter = nullptr;
+
+protected:
+	// Stun or die once per resolved damage batch
+	virtual void OnDamageResolved(
+		float DamageAmount, AActor *DamageCauser) override;
+
+	// Stop the server montage timeline (only for Montage, when given)
+	void StopTimelineMontage(const UAnimMontage *Montage);
+
+	// Pool or destroy once the death animation had time to play
+	void OnDeathFinished();
+
+	// Join or leave the LOD, enemy registry and perception subsystems
+	void RegisterWithWorldSubsystems();
+	void UnregisterFromWorldSubsystems();
+
+	// Timer handle for clearing stun
+	FTimerHandle StunTimerHandle;
+
+	// Timer handle for removing the enemy after death
+	FTimerHandle DeathTimerHandle;
 };
@@ -7,6 +7,7 @@
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "CoreMinimal.h"
+#include "MyBlackboardKeys.h"
 #include "MyEnemyAIController.generated.h"
 
 /**
@@ -23,14 +24,30 @@ public:
 	virtual void OnPossess(APawn *InPawn) override;
 	virtual void OnUnPossess() override;
 
+	// Stop the behavior tree (pooled enemies)
+	void StopBehavior();
+
+	// Clear the blackboard and start the behavior tree from the root, as
+	// after a fresh possess (pooled enemies)
+	void RestartBehavior();
+
 	// Detection range
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
 	float DetectionRange = 500.0f;
 
+	// Key IDs of the running blackboard, resolved at possess
+	const FMyEnemyBlackboardKeys &GetBlackboardKeys() const
+	{
+		return BlackboardKeys;
+	}
+
 protected:
 	virtual void BeginPlay() override;
 
 private:
+	// Write the pawn's blackboard values and start the tree
+	void StartBehavior();
+
 	// Behavior Tree to run
 	UPROPERTY(EditDefaultsOnly, Category = "AI")
 	UBehaviorTree *BehaviorTree;
@@ -42,4 +59,6 @@ private:
 	// Blackboard Component
 	UPROPERTY()
 	UBlackboardComponent *BlackboardComponent;
+
+	FMyEnemyBlackboardKeys BlackboardKeys;
 };
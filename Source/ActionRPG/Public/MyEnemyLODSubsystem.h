@@ -0,0 +1,87 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MyEnemyLODSubsystem.generated.h"
+
+class AMyEnemy;
+
+// Enemy LOD buckets; the value is the significance, higher is closer
+UENUM(BlueprintType)
+enum class EMyEnemyLODBucket : uint8
+{
+	Dormant UMETA(DisplayName = "Dormant"),
+	Far UMETA(DisplayName = "Far"),
+	Mid UMETA(DisplayName = "Mid"),
+	Near UMETA(DisplayName = "Near")
+};
+
+/**
+ * Buckets enemies by distance to the nearest player and by visibility
+ * through the significance manager. Each bucket sets the behavior tree,
+ * movement and animation tick intervals (enemies have no actor tick).
+ * Enemies beyond detection range go dormant (no BT, movement or
+ * animation) until a player comes close or they are woken.
+ */
+UCLASS()
+class ACTIONRPG_API UMyEnemyLODSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	void RegisterEnemy(AMyEnemy *Enemy);
+	void UnregisterEnemy(AMyEnemy *Enemy);
+
+	// Keep Enemy out of dormancy for EnemyWakeDuration
+	void WakeEnemy(AMyEnemy *Enemy);
+
+	EMyEnemyLODBucket GetBucket(const AMyEnemy *Enemy) const;
+
+	int32 GetBucketPopulation(EMyEnemyLODBucket Bucket) const
+	{
+		return BucketPopulations[static_cast<int32>(Bucket)];
+	}
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(
+		const EWorldType::Type WorldType) const override;
+
+private:
+	// Tick intervals for one bucket; zero ticks every frame
+	struct FBucketSettings
+	{
+		float BTInterval = 0.0f;
+		float MovementInterval = 0.0f;
+		float AnimInterval = 0.0f;
+	};
+
+	static FBucketSettings GetBucketSettings(EMyEnemyLODBucket Bucket);
+
+	// Runs on worker threads during the significance update
+	float CalculateSignificance(
+		const AMyEnemy *Enemy, const FTransform &Viewpoint) const;
+
+	// Runs on the game thread when an enemy changes bucket
+	void ApplyBucket(AMyEnemy *Enemy, EMyEnemyLODBucket NewBucket);
+
+	// Restore full-rate ticking (unregister)
+	void ResetEnemy(AMyEnemy *Enemy, EMyEnemyLODBucket OldBucket);
+
+	TMap<TObjectKey<AMyEnemy>, EMyEnemyLODBucket> EnemyBuckets;
+
+	// World time until which each woken enemy skips dormancy
+	TMap<TObjectKey<AMyEnemy>, double> WakeUntilTimes;
+
+	int32 BucketPopulations[4] = {0, 0, 0, 0};
+
+	// Read by CalculateSignificance while the update runs
+	double UpdateTime = 0.0;
+	bool bUseVisibility = false;
+};
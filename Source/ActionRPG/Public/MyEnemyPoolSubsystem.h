@@ -0,0 +1,88 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MyEnemyPoolSubsystem.generated.h"
+
+class AMyEnemy;
+
+/**
+ * Inactive enemies of one class
+ */
+USTRUCT()
+struct FMyEnemyPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<AMyEnemy *> Enemies;
+};
+
+/**
+ * Running totals for the enemy pool
+ */
+struct FMyEnemyPoolCounters
+{
+	// Enemies spawned because the pool was empty
+	int32 Spawns = 0;
+
+	// Pooled enemies reactivated instead of spawning
+	int32 Reuses = 0;
+
+	// Enemies returned to the pool
+	int32 Releases = 0;
+
+	// Released enemies destroyed because their pool was full
+	int32 Overflows = 0;
+};
+
+/**
+ * Keeps dead enemies hidden and inactive instead of destroying them, and
+ * reactivates them at new spawn points. A reused enemy keeps its actor,
+ * controller, attribute component, ability system and health bar widget;
+ * only its state (attributes, effects, tags, behavior tree) is reset.
+ */
+UCLASS()
+class ACTIONRPG_API UMyEnemyPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// Reactivate a pooled enemy of EnemyClass at Transform, or spawn one
+	AMyEnemy *AcquireEnemy(
+		TSubclassOf<AMyEnemy> EnemyClass, const FTransform &Transform);
+
+	// Reactivate a pooled enemy of EnemyClass at Transform; nullptr if the
+	// pool is empty (callers that stage their own spawns)
+	AMyEnemy *TryReuseEnemy(
+		TSubclassOf<AMyEnemy> EnemyClass, const FTransform &Transform);
+
+	// Deactivate Enemy and keep it for reuse (destroyed if the pool is full)
+	void ReleaseEnemy(AMyEnemy *Enemy);
+
+	// Spawn inactive enemies of EnemyClass ahead of their first use
+	void PrewarmEnemies(TSubclassOf<AMyEnemy> EnemyClass, int32 Count);
+
+	const FMyEnemyPoolCounters &GetCounters() const { return Counters; }
+
+	// Number of inactive enemies waiting for reuse
+	int32 GetNumPooled() const;
+
+protected:
+	virtual bool DoesSupportWorldType(
+		const EWorldType::Type WorldType) const override;
+
+private:
+	// Spawn a new enemy with its AI controller
+	AMyEnemy *SpawnEnemy(
+		TSubclassOf<AMyEnemy> EnemyClass, const FTransform &Transform);
+
+	UPROPERTY(Transient)
+	TMap<UClass *, FMyEnemyPool> Pools;
+
+	FMyEnemyPoolCounters Counters;
+};
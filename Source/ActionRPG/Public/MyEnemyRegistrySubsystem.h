@@ -0,0 +1,130 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MyUniformGrid.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MyEnemyRegistrySubsystem.generated.h"
+
+class AMyEnemy;
+
+/**
+ * Tracks every living enemy in a uniform spatial hash (cell size from
+ * EnemyRegistryCellSize) so target acquisition visits only the cells a
+ * query overlaps instead of every actor in the level. Enemies join on
+ * BeginPlay and leave on death or EndPlay; an enemy is rehashed only when
+ * it crosses a cell boundary.
+ *
+ * Range watches report the enemies entering and leaving a circle around a
+ * moving point. Enemies deep inside or far outside it are only looked at
+ * when they cross a cell, so an update costs the enemies that changed cell
+ * plus those in the cells the circle's edge passes through.
+ */
+UCLASS()
+class ACTIONRPG_API UMyEnemyRegistrySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+
+	void RegisterEnemy(AMyEnemy *Enemy);
+	void UnregisterEnemy(AMyEnemy *Enemy);
+
+	// Living enemies within Radius of Location, in no particular order
+	void GetEnemiesInRadius(const FVector &Location, float Radius,
+		TArray<AMyEnemy *> &OutEnemies) const;
+
+	// Up to Count living enemies within Radius of Location, nearest first.
+	// Searches outward from Location's cell and stops once Count are found
+	// closer than any unsearched cell.
+	void FindNearestEnemies(const FVector &Location, float Radius,
+		int32 Count, TArray<AMyEnemy *> &OutEnemies) const;
+
+	// Living enemies within Radius of Origin and HalfAngleDegrees of the
+	// (normalized) Direction, in no particular order
+	void GetEnemiesInCone(const FVector &Origin, const FVector &Direction,
+		float HalfAngleDegrees, float Radius,
+		TArray<AMyEnemy *> &OutEnemies) const;
+
+	int32 GetNumEnemies() const { return Entries.Num(); }
+
+	// Most range watches that can exist at once
+	static constexpr int32 MaxRangeWatches = 32;
+
+	// Start watching the enemies within Radius of a point, measured in the
+	// XY plane. Returns the watch id, or INDEX_NONE if all are taken.
+	int32 AddRangeWatch(float Radius);
+	void RemoveRangeWatch(int32 WatchId);
+
+	// Move the watch to Center and report the living enemies that entered
+	// or left it since the previous update. An enemy that left and came
+	// back (or the reverse) in between is not reported.
+	void UpdateRangeWatch(int32 WatchId, const FVector &Center,
+		TArray<AMyEnemy *> &OutEntered,
+		TArray<TWeakObjectPtr<AMyEnemy>> &OutExited);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(
+		const EWorldType::Type WorldType) const override;
+
+private:
+	struct FEnemyEntry
+	{
+		TObjectKey<AMyEnemy> Key;
+		TWeakObjectPtr<AMyEnemy> Enemy;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+
+		// Bit per range watch the enemy is inside of
+		uint32 WatchMask = 0;
+	};
+
+	struct FRangeWatch
+	{
+		bool bInUse = false;
+
+		// False until the first update gives the watch a center
+		bool bPlaced = false;
+		FVector2D Center = FVector2D::ZeroVector;
+		double Radius = 0.0;
+
+		// Enemies that entered (true) or left (false) since the last
+		// update. Changing back removes the entry instead.
+		TMap<TWeakObjectPtr<AMyEnemy>, bool> Changes;
+	};
+
+	enum class ECellCoverage : uint8
+	{
+		Outside,
+		Partial,
+		Inside
+	};
+
+	void RemoveEntryAt(int32 Index);
+
+	// How much of Cell lies within RadiusSq of Center
+	ECellCoverage GetCellCoverage(const FIntPoint &Cell,
+		const FVector2D &Center, double RadiusSq) const;
+
+	// Recheck whether the entry at Index is inside the watch (or every
+	// watch in use)
+	void RefreshInWatch(int32 WatchId, int32 Index);
+	void RefreshInWatches(int32 Index);
+	void SetInWatch(int32 WatchId, int32 Index, bool bInside);
+
+	// Living enemy of the entry at Index within RadiusSq, or nullptr
+	AMyEnemy *GetEnemyInRange(int32 Index, const FVector &Location,
+		double RadiusSq, double &OutDistSq) const;
+
+	TArray<FEnemyEntry> Entries;
+	TMap<TObjectKey<AMyEnemy>, int32> EntryIndices;
+
+	// Entry indices per cell
+	FMyUniformGrid Grid;
+
+	TArray<FRangeWatch, TInlineAllocator<4>> Watches;
+};
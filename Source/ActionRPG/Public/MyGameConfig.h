@@ -45,9 +45,99 @@ struct FGameConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
 	float EnemyUpdateInterval = 1.0f;
 
+	// Best scored enemies kept as candidates for focusing and target cycling
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	int32 TargetCandidateCount = 8;
+
+	// Lock-on score weights (distance, camera facing, line of sight, threat)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float TargetScoreDistanceWeight = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float TargetScoreFacingWeight = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float TargetScoreVisibilityWeight = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float TargetScoreThreatWeight = 0.5f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
 	float PatrolPointTolerance = 100.0f;
 
+	// Enemy Perception
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	int32 PerceptionTraceBudget = 8;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float PerceptionNearRefreshInterval = 0.1f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float PerceptionFarRefreshInterval = 0.5f;
+
+	// Enemy Wander
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float WanderRadius = 1000.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float WanderTileSize = 2000.0f;
+
+	// Height of a wander tile, so stacked floors get their own points
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float WanderTileHeight = 400.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	int32 WanderPointsPerTile = 16;
+
+	// Enemy LOD (beyond EnemyDetectionRange enemies go dormant)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float EnemyLODNearDistance = 1500.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float EnemyLODMidDistance = 3000.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float EnemyLODMidBTInterval = 0.1f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float EnemyLODMidMovementInterval = 0.033f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float EnemyLODMidAnimInterval = 0.033f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float EnemyLODFarBTInterval = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float EnemyLODFarMovementInterval = 0.1f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float EnemyLODFarAnimInterval = 0.1f;
+
+	// Seconds a woken enemy ignores dormancy
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float EnemyWakeDuration = 5.0f;
+
+	// Boss Area
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gameplay")
+	float BossPrewarmDistance = 3000.0f;
+
+	// Player Registry
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gameplay")
+	float PlayerRegistryCellSize = 2000.0f;
+
+	// Enemy Registry
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gameplay")
+	float EnemyRegistryCellSize = 1000.0f;
+
+	// Enemy Pool (inactive enemies kept per class)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gameplay")
+	int32 EnemyPoolMaxPerClass = 32;
+
+	// Wave Spawner (milliseconds of spawning work per frame)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gameplay")
+	float WaveSpawnBudgetMs = 2.0f;
+
 	// Gameplay Constants
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gameplay")
 	float GroundZCoordinate = 0.0f;
@@ -110,6 +200,36 @@ struct FGameConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
 	int32 MaxComboCount = 3;
 
+	// Lag Compensation
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+	int32 HitHistorySampleCount = 32;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+	int32 HitHistoryMemoryBudgetKB = 64;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+	float MaxRewindTime = 0.25f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+	float RewindHitTolerance = 10.0f;
+
+	// Server Animation
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation")
+	bool bUseServerMontageTimeline = true;
+
+	// Impact Effects
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
+	int32 ImpactFXGlobalBudget = 24;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
+	int32 ImpactFXPerEffectBudget = 8;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
+	int32 ImpactFXPrewarmCount = 4;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
+	float ImpactFXCullDistance = 4000.0f;
+
 	// Camera
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
 	float SpringArmLength = 350.0f;
@@ -126,10 +246,6 @@ struct FGameConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
 	float CameraLagSpeed = 10.0f;
 
-	// Initialization
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Initialization")
-	int32 MaxInitializationRetries = 10;
-
 	// UI Constants
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI")
 	float HealthHighThreshold = 0.6f;
@@ -0,0 +1,31 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "Animation/AnimNotifies/AnimNotify.h"
+#include "CoreMinimal.h"
+#include "MyGameplayAnimNotify.generated.h"
+
+class UAnimMontage;
+
+/**
+ * Base for notifies that drive gameplay (damage, combo windows). They fire
+ * from animation as usual, or from UMyMontageTimelineSubsystem on dedicated
+ * servers, where montage metadata is played without pose evaluation.
+ */
+UCLASS(Abstract)
+class ACTIONRPG_API UMyGameplayAnimNotify : public UAnimNotify
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Notify(USkeletalMeshComponent *MeshComp,
+		UAnimSequenceBase *Animation,
+		const FAnimNotifyEventReference &EventReference) override;
+
+	// Fire the gameplay event for Owner at montage time Position
+	virtual void HandleNotify(
+		AActor *Owner, const UAnimMontage *Montage, float Position)
+	{
+	}
+};
@@ -0,0 +1,34 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NativeGameplayTags.h"
+
+// Native gameplay tags, registered when the module loads so hot paths never
+// resolve tags from strings. Keep in sync with DefaultGameplayTags.ini.
+namespace AbilityTags
+{
+ACTIONRPG_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Attack);
+ACTIONRPG_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Dodge);
+ACTIONRPG_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Jump);
+ACTIONRPG_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Sprint);
+} // namespace AbilityTags
+
+namespace DataTags
+{
+ACTIONRPG_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Damage);
+ACTIONRPG_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Health);
+ACTIONRPG_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(MaxHealth);
+ACTIONRPG_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Stamina);
+ACTIONRPG_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(MaxStamina);
+ACTIONRPG_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(MaxWalkSpeed);
+} // namespace DataTags
+
+namespace StateTags
+{
+ACTIONRPG_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Attacking);
+ACTIONRPG_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Dodging);
+ACTIONRPG_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Jumping);
+ACTIONRPG_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Sprinting);
+} // namespace StateTags
@@ -0,0 +1,101 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MyHitHistorySubsystem.generated.h"
+
+class AMyBaseCharacter;
+
+/**
+ * Server-side pose history for lag-compensated melee hits. Every tracked
+ * character records its location and capsule size each frame into a
+ * fixed-size ring buffer stored as separate arrays per field (slot-major),
+ * so memory is allocated once and bounded by the HitHistoryMemoryBudgetKB
+ * config value. Swings from remote players are validated against their
+ * targets rewound to the time the client saw them.
+ */
+UCLASS()
+class ACTIONRPG_API UMyHitHistorySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+	virtual void Deinitialize() override;
+
+	// Start recording Character; returns false when the budget is full
+	bool RegisterCharacter(AMyBaseCharacter *Character);
+
+	// Stop recording Character and free its slot
+	void UnregisterCharacter(AMyBaseCharacter *Character);
+
+	// True if Actor has a history slot
+	bool IsTracked(const AActor *Actor) const;
+
+	// World time at which the attacker's client saw the targets, or a
+	// negative value when no rewind is needed (standalone, local attacker)
+	double GetClientViewTime(const AActor *Attacker) const;
+
+	// Sweep a capsule (a sphere when HalfHeight <= Radius) with the given
+	// orientation against the tracked hurtboxes of TargetChannel rewound to
+	// Time. Returns the character hit first along the sweep, or nullptr.
+	AMyBaseCharacter *SweepRewound(const FVector &Start, const FVector &End,
+		const FQuat &Rotation, float Radius, float HalfHeight, double Time,
+		ECollisionChannel TargetChannel, const AActor *IgnoreActor,
+		FVector &OutImpactPoint) const;
+
+	// Interpolated capsule of a tracked character at Time
+	bool GetCapsuleAtTime(const AMyBaseCharacter *Character, double Time,
+		FVector &OutLocation, float &OutRadius, float &OutHalfHeight) const;
+
+	// True on servers with remote clients, where history is recorded
+	bool IsRecording() const;
+
+	// Record every tracked character's current pose as a new sample. Tick
+	// calls this while recording.
+	void RecordPoses();
+
+	int32 GetNumTracked() const { return NumTracked; }
+	int32 GetMaxTracked() const { return MaxTracked; }
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(
+		const EWorldType::Type WorldType) const override;
+
+private:
+	// Write the current pose of Slot's character into sample SampleIndex
+	void WriteSample(int32 Slot, int32 SampleIndex);
+
+	// Find the two samples around Time and the blend between them
+	bool FindSamples(double Time, int32 &OutOlder, int32 &OutNewer,
+		float &OutAlpha) const;
+
+	int32 GetStorageIndex(int32 Slot, int32 SampleIndex) const
+	{
+		return Slot * SampleCapacity + SampleIndex;
+	}
+
+	// Ring buffer shape, fixed at Initialize
+	int32 SampleCapacity = 0;
+	int32 MaxTracked = 0;
+
+	// Shared sample times (one per frame for all slots)
+	TArray<double> SampleTimes;
+	int32 NewestSample = INDEX_NONE;
+	int32 NumSamples = 0;
+
+	// Per-sample pose, indexed by GetStorageIndex
+	TArray<FVector3f> Locations;
+	TArray<FVector2f> CapsuleSizes; // X = radius, Y = half height
+
+	// Per-slot owner; null slots are free
+	TArray<TWeakObjectPtr<AMyBaseCharacter>> SlotCharacters;
+	TMap<TObjectKey<AMyBaseCharacter>, int32> CharacterSlots;
+	TArray<int32> FreeSlots;
+	int32 NumTracked = 0;
+};
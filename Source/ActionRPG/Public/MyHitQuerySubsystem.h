@@ -0,0 +1,102 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffect.h"
+#include "MyAbilityTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "MyHitQuerySubsystem.generated.h"
+
+/**
+ * A single attack sweep queued by an attack notify
+ */
+USTRUCT()
+struct FMyAttackSweepRequest
+{
+	GENERATED_BODY()
+
+	// Actor performing the attack
+	TWeakObjectPtr<AActor> Attacker;
+
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+	float Radius = 0.0f;
+
+	// Sweeps a capsule with this orientation when HalfHeight > Radius,
+	// otherwise a sphere
+	FQuat Rotation = FQuat::Identity;
+	float HalfHeight = 0.0f;
+
+	// Sweeps sharing a non-zero group hit at most one target between them
+	uint32 SweepGroup = 0;
+
+	// Hurtbox channel of the attacker's opposing team
+	TEnumAsByte<ECollisionChannel> TargetChannel = ECC_EnemyHurtbox;
+
+	// Damage to apply to the first valid hit
+	float DamageAmount = 0.0f;
+
+	// Effect used when the target takes damage through GAS
+	TSubclassOf<UGameplayEffect> DamageEffectClass;
+
+	// Server world time the attacker's client saw its targets at; when set
+	// (>= 0) hits are validated against rewound target poses
+	double RewindTime = -1.0;
+};
+
+/**
+ * Batches attack sweeps issued during a frame into async traces and resolves
+ * their hits at the start of the next frame's subsystem tick, in issue order
+ */
+UCLASS()
+class ACTIONRPG_API UMyHitQuerySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Queue an attack sweep; results are applied on the next frame
+	void EnqueueAttackSweep(const FMyAttackSweepRequest &Request);
+
+	// Allocate a group id for sweeps that together form one swing
+	uint32 AllocateSweepGroup() { return ++LastSweepGroup; }
+
+	// Number of sweeps waiting for their async results
+	int32 GetNumInFlightSweeps() const { return InFlightSweeps.Num(); }
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(
+		const EWorldType::Type WorldType) const override;
+
+private:
+	struct FInFlightSweep
+	{
+		FMyAttackSweepRequest Request;
+		FTraceHandle TraceHandle;
+		uint64 IssueFrame = 0;
+	};
+
+	// Resolve every sweep issued before the current frame
+	void ResolveCompletedSweeps(UWorld *World);
+
+	// Validate a lag-compensated sweep against rewound target poses;
+	// returns true if a target was hit
+	bool ResolveRewoundSweep(const FInFlightSweep &Sweep,
+		const FTraceDatum *TraceData, UWorld *World) const;
+
+	// Apply damage and effects for the first valid hit of a sweep
+	void ApplyAttackHit(
+		const FMyAttackSweepRequest &Request, const FHitResult &Hit) const;
+
+	// Sweeps in issue order, so resolution is deterministic
+	TArray<FInFlightSweep> InFlightSweeps;
+
+	// Sweeps issued during the current frame (for stats)
+	int32 SweepsIssuedThisFrame = 0;
+
+	uint32 LastSweepGroup = 0;
+};
@@ -0,0 +1,36 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "Components/CapsuleComponent.h"
+#include "CoreMinimal.h"
+#include "MyHurtboxComponent.generated.h"
+
+/**
+ * Query-only capsule that receives combat hits. Its object type
+ * (PlayerHurtbox or EnemyHurtbox) marks the owner's team, so attack sweeps
+ * only ever return damageable targets of the opposing team.
+ */
+UCLASS(ClassGroup = (Collision), meta = (BlueprintSpawnableComponent))
+class ACTIONRPG_API UMyHurtboxComponent : public UCapsuleComponent
+{
+	GENERATED_BODY()
+
+public:
+	UMyHurtboxComponent();
+
+	virtual void OnRegister() override;
+
+	// Hurtbox channel of the other team, used by this owner's attacks
+	ECollisionChannel GetOpposingChannel() const;
+
+	// Stop receiving hits (e.g. on death)
+	void DisableHurtbox();
+
+	// Receive hits again (e.g. when an actor is reused)
+	void EnableHurtbox();
+
+	// Match the owner's movement capsule when registered
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hurtbox")
+	bool bMatchOwnerCapsule = true;
+};
@@ -0,0 +1,96 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MyImpactFXSubsystem.generated.h"
+
+class UNiagaraComponent;
+class UNiagaraSystem;
+
+/**
+ * Pooled components for one impact effect asset
+ */
+USTRUCT()
+struct FMyImpactFXPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<UNiagaraComponent *> Components;
+
+	// World time each component was last activated (parallel to Components)
+	TArray<double> ActivationTimes;
+};
+
+/**
+ * Running totals for the impact FX manager
+ */
+struct FMyImpactFXCounters
+{
+	// Components created (pre-warm or pool growth)
+	int32 Spawns = 0;
+
+	// Pooled components reactivated, including restarts of the oldest
+	// instance of the same effect when a budget is full
+	int32 Reuses = 0;
+
+	// Requests dropped by distance or significance
+	int32 Culls = 0;
+};
+
+/**
+ * Plays impact effects from per-asset pools of Niagara components with a
+ * global and per-effect active budget. Distant impacts are culled; when a
+ * budget is full the oldest instance is reused, unless the new impact is
+ * less significant (farther from the viewer) than everything playing.
+ */
+UCLASS()
+class ACTIONRPG_API UMyImpactFXSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// Play an impact effect; returns nullptr if the request was culled
+	UNiagaraComponent *SpawnImpact(UNiagaraSystem *System,
+		const FVector &Location, const FRotator &Rotation);
+
+	// Create pooled components for System ahead of its first use
+	void PrewarmEffect(UNiagaraSystem *System, int32 Count);
+
+	const FMyImpactFXCounters &GetCounters() const { return Counters; }
+
+	// Number of pooled components currently playing
+	int32 GetNumActive() const { return ActiveComponents.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(
+		const EWorldType::Type WorldType) const override;
+
+private:
+	// Create, register and add one idle component to Pool
+	int32 AddPooledComponent(FMyImpactFXPool &Pool, UNiagaraSystem *System);
+
+	// Restart the component at Index in Pool at the new transform
+	UNiagaraComponent *ActivatePooled(FMyImpactFXPool &Pool, int32 Index,
+		const FVector &Location, const FRotator &Rotation);
+
+	// Location used for distance culling and significance
+	bool GetViewLocation(FVector &OutLocation) const;
+
+	// Bound to every pooled component's OnSystemFinished
+	UFUNCTION()
+	void OnImpactFinished(UNiagaraComponent *Component);
+
+	UPROPERTY(Transient)
+	TMap<UNiagaraSystem *, FMyImpactFXPool> Pools;
+
+	// Pooled components playing right now, kept up to date on activation
+	// and finish so budget checks don't walk every pool
+	TSet<TObjectKey<UNiagaraComponent>> ActiveComponents;
+
+	FMyImpactFXCounters Counters;
+};
@@ -0,0 +1,76 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MyMontageTimelineSubsystem.generated.h"
+
+class UAnimMontage;
+class UAnimSequenceBase;
+struct FAnimSegment;
+
+/**
+ * Plays montage notify metadata on dedicated servers without evaluating
+ * poses. Attack montages are registered when they start; gameplay notifies
+ * (UMyGameplayAnimNotify) fire from each montage's notify list as its
+ * timeline advances, so characters can skip bone updates on the server.
+ * Montages are assumed to play their sections linearly.
+ */
+UCLASS()
+class ACTIONRPG_API UMyMontageTimelineSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// True on dedicated servers when the timeline is enabled in config
+	bool IsTimelineActive() const;
+
+	// Run Montage's notifies for Owner, replacing any montage it was running.
+	// PlayRate is the rate passed to Montage_Play; the montage's RateScale is
+	// applied on top, as Montage_Play does.
+	void StartMontage(
+		AActor *Owner, UAnimMontage *Montage, float PlayRate = 1.0f);
+
+	// Stop Owner's montage (only if it is Montage, when given)
+	void StopMontage(AActor *Owner, const UAnimMontage *Montage = nullptr);
+
+	// True while a montage is running for Owner
+	bool IsRunning(const AActor *Owner) const;
+
+	// True if Owner's running montage is Animation or plays it in one of
+	// its slot segments, so the timeline fires Animation's notifies
+	bool IsRunningAnimation(
+		const AActor *Owner, const UAnimSequenceBase *Animation) const;
+
+	int32 GetNumRunning() const { return Runs.Num(); }
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(
+		const EWorldType::Type WorldType) const override;
+
+private:
+	struct FMontageRun
+	{
+		TWeakObjectPtr<AActor> Owner;
+		TWeakObjectPtr<UAnimMontage> Montage;
+		float Position = 0.0f;
+		float PlayRate = 1.0f;
+	};
+
+	int32 FindRun(const AActor *Owner) const;
+
+	// Fire gameplay notifies of Montage and of the sequences in its slot
+	// segments with montage trigger time in [From, To)
+	int32 FireNotifies(
+		AActor *Owner, const UAnimMontage *Montage, float From, float To);
+
+	// Fire the notifies of Segment's sequence, mapped to montage time
+	int32 FireSegmentNotifies(AActor *Owner, const UAnimMontage *Montage,
+		const FAnimSegment &Segment, float From, float To);
+
+	TArray<FMontageRun> Runs;
+};
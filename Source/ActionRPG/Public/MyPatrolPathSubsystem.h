@@ -0,0 +1,143 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NavigationSystemTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MyPatrolPathSubsystem.generated.h"
+
+class AAIController;
+class ANavigationData;
+class APawn;
+
+/**
+ * Outcome of a patrol move request
+ */
+enum class EMyPatrolMoveResult : uint8
+{
+	// Following the cached path
+	Moving,
+
+	// The leg's path isn't ready yet; move some other way
+	Pending,
+
+	// No path exists on the current navmesh
+	Unreachable,
+};
+
+/**
+ * Running totals for the patrol path cache
+ */
+struct FMyPatrolPathCounters
+{
+	// Moves served from the cache
+	int32 Hits = 0;
+
+	// Moves requested before their leg's path was ready
+	int32 Misses = 0;
+
+	// Legs pathfound, and the time from issuing each query to its result
+	int32 Queries = 0;
+	double ComputeSeconds = 0.0;
+
+	float GetHitRate() const
+	{
+		const int32 Total = Hits + Misses;
+		return Total > 0 ? static_cast<float>(Hits) / Total : 0.0f;
+	}
+
+	// Estimated time hits would have spent pathfinding. An upper bound:
+	// async query times include the wait for the navigation worker.
+	double GetSecondsSaved() const
+	{
+		return Queries > 0 ? Hits * (ComputeSeconds / Queries) : 0.0;
+	}
+};
+
+/**
+ * Caches the navmesh path between consecutive patrol points, shared by
+ * every enemy walking the same route. Legs are pathfound asynchronously
+ * when an enemy with patrol points registers, and enemies follow the
+ * cached path by reference instead of pathfinding each leg themselves.
+ * Paths and failures are kept until the navmesh finishes rebuilding,
+ * which queries every leg again. A leg is dropped once no registered
+ * route walks it.
+ */
+UCLASS()
+class ACTIONRPG_API UMyPatrolPathSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld &InWorld) override;
+	virtual void Deinitialize() override;
+
+	// Start pathfinding every leg of Pawn's patrol route (last point back
+	// to the first). Legs already known are left alone. Registering again
+	// replaces Pawn's previous route.
+	void RegisterRoute(const APawn *Pawn, const TArray<AActor *> &Points);
+
+	// Release Pawn's route; legs no other route walks are dropped
+	void UnregisterRoute(const APawn *Pawn);
+
+	// Move Controller's pawn from patrol point From to To along the cached
+	// path. Legs not registered yet are queued and report Pending.
+	EMyPatrolMoveResult RequestPatrolMove(
+		AAIController *Controller, const AActor *From, const AActor *To);
+
+	// Drop every cached path and failure and pathfind the legs again.
+	// Legs no route walks (only ever moved along) are dropped instead.
+	void InvalidatePaths();
+
+	const FMyPatrolPathCounters &GetCounters() const { return Counters; }
+
+protected:
+	virtual bool DoesSupportWorldType(
+		const EWorldType::Type WorldType) const override;
+
+private:
+	using FPathKey = TTuple<TObjectKey<AActor>, TObjectKey<AActor>,
+		TObjectKey<ANavigationData>>;
+
+	struct FPatrolLeg
+	{
+		TWeakObjectPtr<const AActor> From;
+		TWeakObjectPtr<const AActor> To;
+		TWeakObjectPtr<const ANavigationData> NavData;
+		FNavAgentProperties AgentProperties;
+
+		// Set once the query succeeds
+		FNavPathSharedPtr Path;
+
+		// In-flight query, INVALID_NAVQUERYID when idle
+		uint32 QueryID = INVALID_NAVQUERYID;
+		double QueryStartTime = 0.0;
+
+		bool bUnreachable = false;
+
+		// Registered routes walking this leg
+		int32 NumRoutes = 0;
+	};
+
+	// Find the leg between From and To, adding it if it is new
+	FPatrolLeg &FindOrAddLeg(const FNavAgentProperties &AgentProperties,
+		const ANavigationData &NavData, const AActor *From, const AActor *To);
+
+	// Issue the async path query for Leg. The subsystem is the querier, so
+	// the shared path keeps repathing after any one enemy is gone.
+	void QueryLeg(const FPathKey &Key, FPatrolLeg &Leg);
+
+	void OnLegPathFound(uint32 QueryID, ENavigationQueryResult::Type Result,
+		FNavPathSharedPtr Path, FPathKey Key);
+
+	UFUNCTION()
+	void OnNavigationGenerationFinished(ANavigationData *NavData);
+
+	TMap<FPathKey, FPatrolLeg> Legs;
+
+	// Legs of each registered route, released on unregister
+	TMap<TObjectKey<APawn>, TArray<FPathKey>> Routes;
+
+	FMyPatrolPathCounters Counters;
+};
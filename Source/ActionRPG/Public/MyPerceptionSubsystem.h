@@ -0,0 +1,99 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "MyPerceptionSubsystem.generated.h"
+
+class ACharacter;
+
+/**
+ * Cached perception of the player for one observer
+ */
+struct FMyPerceptionResult
+{
+	// Closest living player in detection range, nullptr if there is none
+	ACharacter *Player = nullptr;
+
+	// Any player is registered, in range or not
+	bool bHasPlayers = false;
+
+	// Player is within the observer's detection range
+	bool bInRange = false;
+
+	// Last line-of-sight trace reached the player
+	bool bHasLineOfSight = false;
+
+	bool CanSeePlayer() const { return Player && bInRange && bHasLineOfSight; }
+};
+
+/**
+ * Keeps per-enemy visibility of the closest player, found through the
+ * player registry. Range is refreshed every frame; line of sight is
+ * refreshed with async traces, round-robin under a per-frame trace budget,
+ * with closer observers refreshed more often.
+ * Behavior tree tasks read the cached result and never trace themselves.
+ */
+UCLASS()
+class ACTIONRPG_API UMyPerceptionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Cached perception for Observer; registers it on first use
+	FMyPerceptionResult GetPerception(APawn *Observer, float DetectionRange);
+
+	// Stop tracking Observer
+	void UnregisterObserver(const APawn *Observer);
+
+	// True if Observer's last trace to Player was blocked; false when
+	// Observer is untracked or watching another player
+	bool IsOccludedFrom(const APawn *Observer, const ACharacter *Player) const;
+
+	int32 GetNumObservers() const { return Observers.Num(); }
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(
+		const EWorldType::Type WorldType) const override;
+
+private:
+	struct FObserverState
+	{
+		TObjectKey<APawn> Key;
+		TWeakObjectPtr<APawn> Observer;
+
+		// Closest player in range, the target of line-of-sight traces
+		TWeakObjectPtr<ACharacter> Player;
+		float DetectionRange = 0.0f;
+		float DistanceToPlayer = 0.0f;
+		bool bInRange = false;
+		bool bHasLineOfSight = false;
+
+		// World time of the last completed line-of-sight trace
+		double LastTraceTime = -UE_BIG_NUMBER;
+
+		FTraceHandle PendingTrace;
+	};
+
+	// Apply line-of-sight results issued on earlier frames
+	void CollectTraceResults(UWorld *World, double Now);
+
+	// Update range and issue traces for the observers most in need
+	void ScheduleTraces(UWorld *World, double Now);
+
+	// Drop observers that were destroyed
+	void RemoveInvalidObservers();
+
+	void RemoveObserverAt(int32 Index);
+
+	TArray<FObserverState> Observers;
+	TMap<TObjectKey<APawn>, int32> ObserverIndices;
+
+	// Round-robin position in Observers
+	int32 NextObserver = 0;
+};
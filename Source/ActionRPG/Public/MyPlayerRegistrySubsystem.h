@@ -0,0 +1,70 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MyUniformGrid.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MyPlayerRegistrySubsystem.generated.h"
+
+class ACharacter;
+
+/**
+ * Tracks every player character in a uniform spatial hash (cell size from
+ * PlayerRegistryCellSize) so AI can find the closest living player, or all
+ * players in a radius, by visiting only the cells the query overlaps.
+ * Cells are refreshed once per frame.
+ */
+UCLASS()
+class ACTIONRPG_API UMyPlayerRegistrySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+
+	void RegisterPlayer(ACharacter *Player);
+	void UnregisterPlayer(ACharacter *Player);
+
+	// Closest living player within Radius of Location, or nullptr
+	ACharacter *FindNearestPlayer(const FVector &Location, float Radius) const;
+
+	// Living players within Radius of Location
+	void GetPlayersInRadius(const FVector &Location, float Radius,
+		TArray<ACharacter *> &OutPlayers) const;
+
+	// All registered players, dead or alive
+	void GetPlayers(TArray<ACharacter *> &OutPlayers) const;
+
+	// First locally controlled player (minimap, HUD), or nullptr
+	ACharacter *GetLocalPlayer() const;
+
+	int32 GetNumPlayers() const { return Entries.Num(); }
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(
+		const EWorldType::Type WorldType) const override;
+
+private:
+	struct FPlayerEntry
+	{
+		TObjectKey<ACharacter> Key;
+		TWeakObjectPtr<ACharacter> Player;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+	};
+
+	void RemoveEntryAt(int32 Index);
+
+	// Living player of the entry at Index within RadiusSq, or nullptr
+	ACharacter *GetTargetInRange(
+		int32 Index, const FVector &Location, double RadiusSq) const;
+
+	TArray<FPlayerEntry> Entries;
+	TMap<TObjectKey<ACharacter>, int32> EntryIndices;
+
+	// Entry indices per cell
+	FMyUniformGrid Grid;
+};
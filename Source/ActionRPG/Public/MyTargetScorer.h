@@ -0,0 +1,63 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Weights of the lock-on score terms
+ */
+struct FMyTargetScoreWeights
+{
+	// Closer candidates score higher (1 at the origin, 0 at Range)
+	float Distance = 1.0f;
+
+	// Candidates nearer the view direction score higher
+	float Facing = 1.0f;
+
+	// Candidates with line of sight score higher
+	float Visibility = 0.5f;
+
+	// Candidates with higher threat score higher
+	float Threat = 0.5f;
+};
+
+/**
+ * Scores lock-on candidates by distance, view facing, occlusion and threat.
+ * Candidates are stored as separate float arrays (structure of arrays)
+ * relative to the scoring origin and padded to the vector width, so one
+ * pass scores four candidates per instruction.
+ */
+class ACTIONRPG_API FMyTargetScorer
+{
+public:
+	// Drop all candidates and score around Origin from now on
+	void Reset(const FVector &InOrigin);
+
+	// Add a candidate; returns its index
+	int32 Add(const FVector &Location, bool bOccluded, float Threat);
+
+	int32 Num() const { return NumCandidates; }
+
+	// Score every candidate; Forward must be normalized
+	void Score(const FVector &Forward, float Range,
+		const FMyTargetScoreWeights &Weights);
+
+	// Score of the candidate at Index from the last Score call
+	float GetScore(int32 Index) const { return Scores[Index]; }
+
+	// Indices of the Count best scored candidates, best first
+	void SelectBest(int32 Count, TArray<int32> &OutIndices) const;
+
+private:
+	FVector Origin = FVector::ZeroVector;
+	int32 NumCandidates = 0;
+
+	// Per-candidate data, padded with zeros to a multiple of 4
+	TArray<float> OffsetX;
+	TArray<float> OffsetY;
+	TArray<float> OffsetZ;
+	TArray<float> Visibilities; // 1 visible, 0 occluded
+	TArray<float> Threats;
+	TArray<float> Scores;
+};
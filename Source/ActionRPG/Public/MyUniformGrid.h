@@ -0,0 +1,135 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Uniform 2D grid (XY) of integer element indices for spatial queries.
+ * Owners keep their elements in arrays and store each element's cell;
+ * the grid only maps cells to the indices inside them.
+ */
+class ACTIONRPG_API FMyUniformGrid
+{
+public:
+	using FCellElements = TArray<int32, TInlineAllocator<4>>;
+
+	explicit FMyUniformGrid(float InCellSize = 1000.0f)
+		: CellSize(FMath::Max(1.0f, InCellSize))
+	{
+	}
+
+	// Change the cell size; only valid while the grid is empty
+	void SetCellSize(float InCellSize)
+	{
+		check(Cells.Num() == 0);
+		CellSize = FMath::Max(1.0f, InCellSize);
+	}
+
+	float GetCellSize() const { return CellSize; }
+
+	FIntPoint GetCell(const FVector &Location) const
+	{
+		return FIntPoint(FMath::FloorToInt32(Location.X / CellSize),
+			FMath::FloorToInt32(Location.Y / CellSize));
+	}
+
+	void Add(int32 Index, const FIntPoint &Cell);
+	void Remove(int32 Index, const FIntPoint &Cell);
+	void Reset() { Cells.Reset(); }
+
+	// Number of occupied cells
+	int32 GetNumCells() const { return Cells.Num(); }
+
+	// Call Visit(Index) for every element in the cells overlapping the
+	// circle; callers still test the exact distance
+	template<typename FunctionType>
+	void ForEachInRadius(
+		const FVector &Location, float Radius, FunctionType &&Visit) const
+	{
+		const FIntPoint MinCell = GetCell(Location - FVector(Radius));
+		const FIntPoint MaxCell = GetCell(Location + FVector(Radius));
+
+		// Huge radii cover more cells than are occupied; walk those instead
+		const int64 NumQueryCells =
+			static_cast<int64>(MaxCell.X - MinCell.X + 1)
+			* (MaxCell.Y - MinCell.Y + 1);
+		if(NumQueryCells > Cells.Num())
+		{
+			for(const TPair<FIntPoint, FCellElements> &Pair : Cells)
+			{
+				for(const int32 Index : Pair.Value)
+				{
+					Visit(Index);
+				}
+			}
+			return;
+		}
+
+		for(int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+		{
+			for(int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+			{
+				const FCellElements *CellElements =
+					Cells.Find(FIntPoint(CellX, CellY));
+				if(!CellElements)
+				{
+					continue;
+				}
+
+				for(const int32 Index : *CellElements)
+				{
+					Visit(Index);
+				}
+			}
+		}
+	}
+
+	// Call Visit(Index) for every element in Cell
+	template<typename FunctionType>
+	void ForEachInCell(const FIntPoint &Cell, FunctionType &&Visit) const
+	{
+		if(const FCellElements *CellElements = Cells.Find(Cell))
+		{
+			for(const int32 Index : *CellElements)
+			{
+				Visit(Index);
+			}
+		}
+	}
+
+	// Call Visit(Index) for every element in the cells exactly Ring cells
+	// away from Center (the square ring of cells around it; Ring 0 is
+	// Center itself). Every point within Ring * CellSize of a location in
+	// Center lies in rings 0 to Ring.
+	template<typename FunctionType>
+	void ForEachInRing(
+		const FIntPoint &Center, int32 Ring, FunctionType &&Visit) const
+	{
+		const auto VisitCell = [this, &Visit](int32 CellX, int32 CellY) {
+			ForEachInCell(FIntPoint(CellX, CellY), Visit);
+		};
+
+		if(Ring == 0)
+		{
+			VisitCell(Center.X, Center.Y);
+			return;
+		}
+
+		// Top and bottom rows, then the columns between them
+		for(int32 CellX = Center.X - Ring; CellX <= Center.X + Ring; ++CellX)
+		{
+			VisitCell(CellX, Center.Y - Ring);
+			VisitCell(CellX, Center.Y + Ring);
+		}
+		for(int32 CellY = Center.Y - Ring + 1; CellY < Center.Y + Ring; ++CellY)
+		{
+			VisitCell(Center.X - Ring, CellY);
+			VisitCell(Center.X + Ring, CellY);
+		}
+	}
+
+private:
+	float CellSize;
+	TMap<FIntPoint, FCellElements> Cells;
+};
@@ -0,0 +1,63 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NavigationSystemTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MyWanderPointSubsystem.generated.h"
+
+class AAIController;
+class ANavigationData;
+
+/**
+ * Caches pools of navigable wander points per world tile so idle enemies
+ * don't run a reachability query each time they pick a destination. Tiles
+ * are cut into height bands so stacked floors get their own points. Paths
+ * to the chosen point are found with async queries off the game thread,
+ * and all pools are dropped when the navmesh finishes rebuilding.
+ */
+UCLASS()
+class ACTIONRPG_API UMyWanderPointSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld &InWorld) override;
+	virtual void Deinitialize() override;
+
+	// Pick a cached point within Radius of the controller's pawn and start
+	// an async path query to it. Returns false if no point is available.
+	bool RequestWanderMove(
+		AAIController *Controller, float Radius, FVector &OutGoal);
+
+	// True while a path query for Controller is in flight
+	bool IsMovePending(const AAIController *Controller) const;
+
+	// Drop Controller's in-flight query so its result is ignored
+	void CancelWanderMove(const AAIController *Controller);
+
+	// Forget every cached pool; they refill on demand
+	void InvalidatePools();
+
+protected:
+	virtual bool DoesSupportWorldType(
+		const EWorldType::Type WorldType) const override;
+
+private:
+	// Cached points for Tile, sampled on first use
+	const TArray<FVector> &GetTilePoints(const FIntVector &Tile);
+
+	FIntVector GetTile(const FVector &Location) const;
+
+	void OnPathFound(uint32 QueryID, ENavigationQueryResult::Type Result,
+		FNavPathSharedPtr Path, TWeakObjectPtr<AAIController> Controller);
+
+	UFUNCTION()
+	void OnNavigationGenerationFinished(ANavigationData *NavData);
+
+	TMap<FIntVector, TArray<FVector>> TilePoints;
+
+	// In-flight path query per controller
+	TMap<TObjectKey<AAIController>, uint32> PendingQueries;
+};
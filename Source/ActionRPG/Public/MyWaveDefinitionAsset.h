@@ -0,0 +1,55 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "MyWaveDefinitionAsset.generated.h"
+
+class AMyEnemy;
+
+/**
+ * Number of enemies of one class in a wave
+ */
+USTRUCT(BlueprintType)
+struct FMyWaveEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave")
+	TSubclassOf<AMyEnemy> EnemyClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave",
+		meta = (ClampMin = "0"))
+	int32 Count = 1;
+};
+
+/**
+ * One wave; it starts StartDelay seconds after the previous wave is
+ * cleared (or after the waves are started, for the first one)
+ */
+USTRUCT(BlueprintType)
+struct FMyWaveDefinition
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave",
+		meta = (ClampMin = "0"))
+	float StartDelay = 3.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave")
+	TArray<FMyWaveEntry> Entries;
+};
+
+/**
+ * Ordered list of enemy waves run by the wave spawner subsystem
+ */
+UCLASS(BlueprintType)
+class ACTIONRPG_API UMyWaveDefinitionAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave")
+	TArray<FMyWaveDefinition> Waves;
+};
@@ -0,0 +1,103 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MyWaveSpawnerSubsystem.generated.h"
+
+class AMyEnemy;
+class UMyWaveDefinitionAsset;
+
+/**
+ * Runs the waves of a wave definition asset at a set of spawn points.
+ * Spawning is time sliced: each frame works through the spawn pipeline
+ * until WaveSpawnBudgetMs is used, and every new enemy moves through
+ * construction, FinishSpawning (component registration and BeginPlay,
+ * which initialize GAS) and AI possession on separate frames. Pooled
+ * enemies are reused in a single step.
+ */
+UCLASS()
+class ACTIONRPG_API UMyWaveSpawnerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Start running Waves, spawning round robin at SpawnPoints; any waves
+	// already running are stopped
+	UFUNCTION(BlueprintCallable, Category = "Waves")
+	bool StartWaves(
+		UMyWaveDefinitionAsset *Waves, const TArray<AActor *> &SpawnPoints);
+
+	// Stop spawning; enemies already spawned stay
+	UFUNCTION(BlueprintCallable, Category = "Waves")
+	void StopWaves();
+
+	UFUNCTION(BlueprintPure, Category = "Waves")
+	bool IsRunning() const { return WaveAsset != nullptr; }
+
+	// Index of the current wave, INDEX_NONE before the first one
+	UFUNCTION(BlueprintPure, Category = "Waves")
+	int32 GetCurrentWave() const { return CurrentWave; }
+
+	// Most time spent spawning in one frame since the waves started
+	double GetWorstFrameSeconds() const { return WorstFrameSeconds; }
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(
+		const EWorldType::Type WorldType) const override;
+
+private:
+	struct FPendingSpawn
+	{
+		TSubclassOf<AMyEnemy> EnemyClass;
+		FTransform Transform;
+	};
+
+	struct FPendingFinish
+	{
+		TWeakObjectPtr<AMyEnemy> Enemy;
+		FTransform Transform;
+	};
+
+	// Queue the enemies of wave WaveIndex
+	void BeginWave(int32 WaveIndex);
+
+	// Start the next wave once the current one is cleared and its delay
+	// has passed
+	void UpdateWaves();
+
+	// True when nothing is queued and every enemy of the wave is dead
+	bool IsWaveCleared() const;
+
+	// Move enemies through the pipeline until Deadline; returns the
+	// number of steps taken
+	int32 ProcessPipeline(double Deadline);
+
+	// Reuse or construct the enemy of a spawn request
+	void ConstructEnemy(const FPendingSpawn &Spawn);
+
+	UPROPERTY(Transient)
+	UMyWaveDefinitionAsset *WaveAsset = nullptr;
+
+	TArray<FTransform> SpawnTransforms;
+	int32 NextSpawnPoint = 0;
+
+	int32 CurrentWave = INDEX_NONE;
+
+	// World time the next wave starts, negative while not scheduled
+	double NextWaveTime = -1.0;
+
+	// Spawn pipeline, oldest first
+	TArray<FPendingSpawn> PendingSpawns;
+	TArray<FPendingFinish> PendingFinishes;
+	TArray<TWeakObjectPtr<AMyEnemy>> PendingPossessions;
+
+	// Enemies of the current wave
+	TArray<TWeakObjectPtr<AMyEnemy>> WaveEnemies;
+
+	double WorstFrameSeconds = 0.0;
+};
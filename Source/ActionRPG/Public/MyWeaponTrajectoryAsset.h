@@ -0,0 +1,119 @@
+// Copyright 2025 ngmitam. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "MyWeaponTrajectoryAsset.generated.h"
+
+class AMyBaseCharacter;
+class UAnimMontage;
+class USkeletalMesh;
+
+/**
+ * Weapon blade segment at one baked frame, in actor space
+ */
+USTRUCT()
+struct FMyTrajectorySample
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FVector3f Start = FVector3f::ZeroVector;
+
+	UPROPERTY()
+	FVector3f End = FVector3f::ZeroVector;
+};
+
+/**
+ * Baked weapon path for one attack montage
+ */
+USTRUCT(BlueprintType)
+struct FMyMontageTrajectory
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Trajectory")
+	UAnimMontage *Montage = nullptr;
+
+	// Sockets (or bones) at the two ends of the weapon
+	UPROPERTY(EditAnywhere, Category = "Trajectory")
+	FName StartSocket;
+
+	UPROPERTY(EditAnywhere, Category = "Trajectory")
+	FName EndSocket;
+
+	// Capsule radius around the blade segment
+	UPROPERTY(EditAnywhere, Category = "Trajectory")
+	float Radius = 10.0f;
+
+	// Seconds between baked samples
+	UPROPERTY(VisibleAnywhere, Category = "Trajectory")
+	float SampleInterval = 0.0f;
+
+	// One sample per SampleInterval from montage time 0
+	UPROPERTY(VisibleAnywhere, Category = "Trajectory")
+	TArray<FMyTrajectorySample> Samples;
+};
+
+/**
+ * Per-frame weapon capsule segments baked in the editor from attack
+ * montages. At runtime attacks sweep these segments instead of evaluating
+ * bone transforms, so hits follow the real weapon path even when the pose
+ * is not evaluated (e.g. on dedicated servers).
+ */
+UCLASS(BlueprintType)
+class ACTIONRPG_API UMyWeaponTrajectoryAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// Baked trajectory for Montage, nullptr if it was never baked
+	const FMyMontageTrajectory *FindTrajectory(
+		const UAnimMontage *Montage) const;
+
+#if WITH_EDITOR
+	// Add entries for the source character's attack montages and resample
+	// every entry from the skeletal mesh
+	UFUNCTION(CallInEditor, Category = "Bake")
+	void BakeTrajectories();
+#endif
+
+	// Mesh whose sockets are sampled
+	UPROPERTY(EditAnywhere, Category = "Bake")
+	USkeletalMesh *SkeletalMesh;
+
+	// Mesh component transform relative to the actor (capsule)
+	UPROPERTY(EditAnywhere, Category = "Bake")
+	FTransform MeshRelativeTransform;
+
+	// Character class whose attack montages are added on bake
+	UPROPERTY(EditAnywhere, Category = "Bake")
+	TSubclassOf<AMyBaseCharacter> SourceCharacterClass;
+
+	// Defaults for entries added from SourceCharacterClass
+	UPROPERTY(EditAnywhere, Category = "Bake")
+	FName DefaultStartSocket;
+
+	UPROPERTY(EditAnywhere, Category = "Bake")
+	FName DefaultEndSocket;
+
+	UPROPERTY(EditAnywhere, Category = "Bake")
+	float DefaultRadius = 10.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Bake", meta = (ClampMin = "1.0"))
+	float SampleRate = 30.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Trajectories")
+	TArray<FMyMontageTrajectory> Trajectories;
+
+private:
+#if WITH_EDITOR
+	void GatherSourceMontages();
+	void BakeTrajectory(FMyMontageTrajectory &Trajectory) const;
+
+	// Actor-space transform of SocketName at montage Time
+	bool GetSocketTransform(const UAnimMontage *Montage, FName SocketName,
+		float Time, FTransform &OutTransform) const;
+#endif
+};